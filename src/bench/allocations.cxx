@@ -0,0 +1,164 @@
+#include "allocations.hxx"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+
+namespace {
+    // process wide, allocations may come from any thread
+    std::atomic<bool>          tracking{false};
+    std::atomic<std::uint64_t> allocations{0};
+    std::atomic<std::uint64_t> bytes{0};
+    std::atomic<std::int64_t>  live{0};  // may drop below zero when memory allocated earlier is freed
+    std::atomic<std::int64_t>  peak{0};
+
+#ifdef __GLIBC__
+    auto block_size(void* pointer) -> std::int64_t {
+        return static_cast<std::int64_t>(malloc_usable_size(pointer));
+    }
+
+    auto on_allocate(void* pointer) -> void {
+        if (not tracking.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        const auto size = block_size(pointer);
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        bytes.fetch_add(static_cast<std::uint64_t>(size), std::memory_order_relaxed);
+
+        const auto now = live.fetch_add(size, std::memory_order_relaxed) + size;
+        auto       max = peak.load(std::memory_order_relaxed);
+        while (now > max && not peak.compare_exchange_weak(max, now, std::memory_order_relaxed)) {
+        }
+    }
+
+    auto on_deallocate(void* pointer) -> void {
+        if (pointer != nullptr && tracking.load(std::memory_order_relaxed)) {
+            live.fetch_sub(block_size(pointer), std::memory_order_relaxed);
+        }
+    }
+
+    // the usual operator new loop: ask the new handler for memory until it gives up
+    template<typename Allocate>
+    auto allocate(Allocate function) -> void* {
+        while (true) {
+            if (auto* const pointer = function()) {
+                on_allocate(pointer);
+                return pointer;
+            }
+            if (const auto handler = std::get_new_handler()) {
+                handler();
+            } else {
+                throw std::bad_alloc{};
+            }
+        }
+    }
+#endif
+}  // namespace
+
+
+#ifdef __GLIBC__
+// Replacements of the global operators. The array and nothrow forms of the library forward to these.
+
+auto operator new(std::size_t size) -> void* {
+    return allocate([size] { return std::malloc(std::max(size, std::size_t{1})); });
+}
+
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* {
+    // aligned_alloc wants a multiple of the alignment
+    const auto align   = static_cast<std::size_t>(alignment);
+    const auto rounded = std::max((size + align - 1) / align, std::size_t{1}) * align;
+    return allocate([rounded, align] { return std::aligned_alloc(align, rounded); });
+}
+
+auto operator delete(void* pointer) noexcept -> void {
+    on_deallocate(pointer);
+    std::free(pointer);
+}
+
+auto operator delete(void* pointer, std::size_t /*size*/) noexcept -> void {
+    on_deallocate(pointer);
+    std::free(pointer);
+}
+
+auto operator delete(void* pointer, std::align_val_t /*alignment*/) noexcept -> void {
+    on_deallocate(pointer);
+    std::free(pointer);
+}
+
+auto operator delete(void* pointer, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept -> void {
+    on_deallocate(pointer);
+    std::free(pointer);
+}
+#endif
+
+
+namespace bench {
+    auto AllocationTracker::available() -> bool {
+#ifdef __GLIBC__
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    auto AllocationTracker::start() -> void {
+        allocations.store(0, std::memory_order_relaxed);
+        bytes.store(0, std::memory_order_relaxed);
+        live.store(0, std::memory_order_relaxed);
+        peak.store(0, std::memory_order_relaxed);
+        tracking.store(true, std::memory_order_release);
+    }
+
+    auto AllocationTracker::stop() -> void {
+        tracking.store(false, std::memory_order_release);
+        allocations_ += allocations.load(std::memory_order_relaxed);
+        bytes_ += bytes.load(std::memory_order_relaxed);
+        peak_heap_ = std::max(peak_heap_, static_cast<std::size_t>(peak.load(std::memory_order_relaxed)));
+    }
+
+    auto AllocationTracker::add_arena(std::size_t bytes) -> void {
+        arena_ += bytes;
+    }
+
+    auto AllocationTracker::means(std::size_t runs) const -> AllocationCounts {
+        const auto count = static_cast<double>(std::max(runs, std::size_t{1}));
+        return {
+            .allocations = static_cast<double>(allocations_) / count,
+            .bytes       = static_cast<double>(bytes_) / count,
+            .arena       = static_cast<double>(arena_) / count,
+            .peak_heap   = peak_heap_,
+        };
+    }
+
+    auto reset_peak_rss() -> bool {
+        // "5" resets the high-water mark only, see proc(5)
+        auto stream = std::ofstream{"/proc/self/clear_refs"};
+        return static_cast<bool>(stream << "5" << std::flush);
+    }
+
+    auto peak_rss() -> std::optional<std::size_t> {
+        constexpr auto FIELD = std::string_view{"VmHWM:"};
+
+        auto stream = std::ifstream{"/proc/self/status"};
+        for (auto line = std::string{}; std::getline(stream, line);) {
+            if (line.starts_with(FIELD)) {
+                // e.g. "VmHWM:     3456 kB"
+                return std::stoul(line.substr(FIELD.size())) * 1024;
+            }
+        }
+        return std::nullopt;
+    }
+}  // namespace bench
@@ -0,0 +1,49 @@
+#ifndef BENCH_ALLOCATIONS_HXX
+#define BENCH_ALLOCATIONS_HXX
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+
+namespace bench {
+    // means per run, except for the peaks which are the highest seen in any run
+    struct AllocationCounts {
+        double                     allocations = 0.0;
+        double                     bytes       = 0.0;  // heap bytes including the allocator's rounding
+        double                     arena       = 0.0;  // bytes handed out by the run's core::Arena
+        std::size_t                peak_heap   = 0;    // most heap bytes alive at once, relative to the start of a run
+        std::optional<std::size_t> peak_rss{};         // resident set high-water mark of the process
+    };
+
+    // Counts the global operator new and delete calls of the whole process between `start` and `stop`.
+    //
+    // aoc-bench replaces the global operators, so every std container is seen; pmr containers built on the
+    // arena only reach the heap when the arena grows, their requests are accounted through `add_arena`.
+    // Tracking is off outside of `start` and `stop`, it costs one relaxed load per allocation then.
+    class AllocationTracker {
+    public:
+        // false where the replacement operators can't size a block (anything but glibc)
+        [[nodiscard]] static auto available() -> bool;
+
+        auto start() -> void;
+        auto stop() -> void;
+        auto add_arena(std::size_t bytes) -> void;
+
+        [[nodiscard]] auto means(std::size_t runs) const -> AllocationCounts;
+
+    private:
+        std::uint64_t allocations_ = 0;
+        std::uint64_t bytes_       = 0;
+        std::uint64_t arena_       = 0;
+        std::size_t   peak_heap_   = 0;
+    };
+
+    // Restarts the resident set high-water mark (Linux 4.0+), false if the kernel doesn't allow it.
+    auto reset_peak_rss() -> bool;
+
+    // VmHWM of the process in bytes, empty where /proc isn't available
+    [[nodiscard]] auto peak_rss() -> std::optional<std::size_t>;
+}  // namespace bench
+
+#endif  // BENCH_ALLOCATIONS_HXX
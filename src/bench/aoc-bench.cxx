@@ -0,0 +1,228 @@
+#include "allocations.hxx"
+#include "benchmark.hxx"
+#include "perf.hxx"
+#include "day-1/trebuchet.hxx"
+#include "day-10/pipe-maze.hxx"
+#include "day-11/cosmic-expansion.hxx"
+#include "day-12/hot-springs.hxx"
+#include "day-13/point-of-incidence.hxx"
+#include "day-14/parabolic-reflector-dish.hxx"
+#include "day-15/lens-library.hxx"
+#include "day-16/the-floor-will-be-lava.hxx"
+#include "day-17/clumsy-crucible.hxx"
+#include "day-18/lavaduct-lagoon.hxx"
+#include "day-19/aplenty.hxx"
+#include "day-2/cube-conundrum.hxx"
+#include "day-20/pulse-propagation.hxx"
+#include "day-21/step-counter.hxx"
+#include "day-3/gear-ratios.hxx"
+#include "day-4/scratchcards.hxx"
+#include "day-5/seed-fertilizer.hxx"
+#include "day-6/wait-for-it.hxx"
+#include "day-7/camel-cards.hxx"
+#include "day-8/haunted-wasteland.hxx"
+#include "day-9/mirage-maintenance.hxx"
+
+#include <core/io.hxx>
+#include <core/numbers.hxx>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+
+namespace {
+    using Runner = std::function<std::vector<bench::Measurement>(std::string_view input, const bench::Options& options)>;
+
+    template<typename Parse, typename... Parts>
+    auto make_runner(Parse parse, Parts... parts) -> Runner {
+        return [=](std::string_view input, const bench::Options& options) {
+            return bench::measure_day(input, options, parse, parts...);
+        };
+    }
+
+    const auto DAYS = std::map<std::size_t, Runner>{
+        {1, make_runner(day_1::parse, day_1::part_one)},
+        {2, make_runner(day_2::parse, day_2::part_one, day_2::part_two)},
+        {3, make_runner(day_3::parse, day_3::part_one, day_3::part_two)},
+        {4, make_runner(day_4::parse, day_4::part_one, day_4::part_two)},
+        {5, make_runner(day_5::parse, day_5::part_one, day_5::part_two)},
+        {6, make_runner(day_6::parse, day_6::part_one, day_6::part_two)},
+        {7, make_runner(day_7::parse, day_7::part_one, day_7::part_two)},
+        {8, make_runner(day_8::parse, day_8::part_one, day_8::part_two)},
+        {9, make_runner(day_9::parse, day_9::part_one, day_9::part_two)},
+        {10, make_runner(day_10::parse, day_10::part_one, day_10::part_two)},
+        {11, make_runner(day_11::parse, day_11::part_one, day_11::part_two)},
+        {12, make_runner(day_12::parse, day_12::part_one, day_12::part_two)},
+        {13, make_runner(day_13::parse, day_13::part_one, day_13::part_two)},
+        {14, make_runner(day_14::parse, day_14::part_one, [](const day_14::Grid& grid) { return day_14::part_two(grid); })},
+        {15, make_runner(day_15::parse, day_15::part_one, day_15::part_two)},
+        {16, make_runner(day_16::parse, day_16::part_one, day_16::part_two)},
+        {17,
+         make_runner(
+             day_17::parse, [](const day_17::Grid& map) { return day_17::part_one(map); },
+             [](const day_17::Grid& map) { return day_17::part_two(map); }
+         )},
+        {18, make_runner(day_18::parse, day_18::part_one, day_18::part_two)},
+        {19, make_runner(day_19::parse, day_19::part_one, day_19::part_two)},
+        {20, make_runner(day_20::parse, day_20::part_one, day_20::part_two)},
+        {21,
+         make_runner(
+             day_21::parse, [](const day_21::Grid& garden) { return day_21::part_one(garden); },
+             [](const day_21::Grid& garden) { return day_21::part_two(garden); }
+         )},
+    };
+
+    // Both day 17 searches on the bucket queue and on the binary heap they ran on before, against one parsed map.
+    auto measure_queues(std::string_view input, const bench::Options& options) -> std::vector<bench::Measurement> {
+        constexpr auto QUEUES = std::array{
+            std::tuple{"one/bkt", "two/bkt", day_17::Queue::BUCKETS},
+            std::tuple{"one/heap", "two/heap", day_17::Queue::BINARY_HEAP},
+        };
+
+        const auto map          = day_17::parse(input);
+        auto       measurements = std::vector<bench::Measurement>{};
+        for (const auto& [one, two, queue] : QUEUES) {
+            measurements.push_back({
+                .day        = 17,
+                .phase      = one,
+                .answer     = std::format("{}", day_17::part_one(map, queue)),
+                .statistics = bench::measure(options, [&] { return day_17::part_one(map, queue); }),
+            });
+            measurements.push_back({
+                .day        = 17,
+                .phase      = two,
+                .answer     = std::format("{}", day_17::part_two(map, queue)),
+                .statistics = bench::measure(options, [&] { return day_17::part_two(map, queue); }),
+            });
+        }
+        return measurements;
+    }
+
+    struct Arguments {
+        bench::Options           options;
+        std::vector<std::size_t> days;
+        std::filesystem::path    inputs = ".";
+        std::filesystem::path    json;
+        bool                     queues = false;
+    };
+
+    auto usage() -> std::string_view {
+        return "usage: aoc-bench [--day N[,N...]] [--inputs DIR] [--warmup N] [--runs N] [--counters] [--allocations]\n"
+               "                 [--queues] [--json FILE|-]\n"
+               "  runs every selected day on DIR/day-N/input.data and reports parse and part timings\n"
+               "  --queues times both day 17 parts on the bucket queue and on a binary heap, alone unless --day is given\n"
+               "  --counters adds cycles, instructions, cache and branch misses per run (Linux perf_event_open)\n"
+               "  counted runs fold on a single thread, so the days that fold in parallel are counted in full\n"
+               "  --allocations adds heap allocations, heap and arena bytes, peak heap and peak RSS per run\n"
+               "  both are collected in runs of their own after the timed ones, which they don't slow down\n";
+    }
+
+    auto parse_arguments(std::span<char*> arguments) -> Arguments {
+        auto result = Arguments{};
+
+        for (auto it = arguments.begin(); it != arguments.end(); ++it) {
+            const auto argument = std::string_view{*it};
+            const auto value    = [&]() -> std::string_view {
+                if (std::next(it) == arguments.end()) {
+                    throw std::invalid_argument(std::format("missing value for {}", argument));
+                }
+                return *++it;
+            };
+
+            if (argument == "--day") {
+                std::ranges::copy(core::numbers::parse_numbers<std::size_t>(value()), std::back_inserter(result.days));
+            } else if (argument == "--inputs") {
+                result.inputs = value();
+            } else if (argument == "--warmup") {
+                result.options.warmup = core::numbers::parse<std::size_t>(value());
+            } else if (argument == "--runs") {
+                result.options.runs = core::numbers::parse<std::size_t>(value());
+            } else if (argument == "--counters") {
+                result.options.counters = true;
+            } else if (argument == "--allocations") {
+                result.options.allocations = true;
+            } else if (argument == "--queues") {
+                result.queues = true;
+            } else if (argument == "--json") {
+                result.json = value();
+            } else {
+                throw std::invalid_argument(std::format("unknown argument {}", argument));
+            }
+        }
+
+        if (result.days.empty() && not result.queues) {
+            std::ranges::copy(DAYS | std::views::keys, std::back_inserter(result.days));
+        }
+
+        return result;
+    }
+}  // namespace
+
+
+auto main(int argc, char* argv[]) -> int {
+    try {
+        auto arguments = parse_arguments({argv + 1, argv + argc});
+        if (arguments.options.counters) {
+            // e.g. kernel.perf_event_paranoid or a container without PMU access, timings are still worth having
+            if (const auto probe = bench::PerfCounters{}; not probe.available()) {
+                std::cerr << std::format("Hardware counters are unavailable ({}), measuring time only\n", probe.error());
+                arguments.options.counters = false;
+            }
+        }
+        if (arguments.options.allocations && not bench::AllocationTracker::available()) {
+            std::cerr << "Allocation tracking needs glibc, measuring time only\n";
+            arguments.options.allocations = false;
+        }
+
+        auto measurements = std::vector<bench::Measurement>{};
+        if (arguments.queues) {
+            const auto input = core::io::MappedFile{arguments.inputs / "day-17" / "input.data"};
+            measurements     = measure_queues(input.view(), arguments.options);
+        }
+        for (const auto day : arguments.days) {
+            const auto runner = DAYS.find(day);
+            if (runner == DAYS.end()) {
+                throw std::invalid_argument(std::format("there is no solver for day {}", day));
+            }
+
+            const auto input = core::io::MappedFile{arguments.inputs / std::format("day-{}", day) / "input.data"};
+            for (auto& measurement : runner->second(input.view(), arguments.options)) {
+                measurement.day = day;
+                measurements.push_back(std::move(measurement));
+            }
+        }
+
+        bench::print_table(std::cout, measurements);
+        if (arguments.json == "-") {
+            bench::write_json(std::cout, arguments.options, measurements);
+        } else if (not arguments.json.empty()) {
+            auto stream = std::ofstream{arguments.json};
+            bench::write_json(stream, arguments.options, measurements);
+        }
+    } catch (const std::invalid_argument& ex) {
+        std::cerr << std::format("{}\n{}", ex.what(), usage());
+        return 2;
+    } catch (const std::exception& ex) {  // NOLINT: std::exception if fine here
+        std::cerr << std::format("Critical error: {}\n", ex.what());
+        return 1;
+    }
+
+    return 0;
+}
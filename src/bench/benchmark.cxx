@@ -0,0 +1,207 @@
+#include "benchmark.hxx"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace {
+    auto format_duration(double nanoseconds) -> std::string {
+        if (nanoseconds < 1e3) {
+            return std::format("{:.0f} ns", nanoseconds);
+        }
+        if (nanoseconds < 1e6) {
+            return std::format("{:.2f} us", nanoseconds / 1e3);
+        }
+        if (nanoseconds < 1e9) {
+            return std::format("{:.2f} ms", nanoseconds / 1e6);
+        }
+        return std::format("{:.3f} s", nanoseconds / 1e9);
+    }
+
+    auto format_count(const std::optional<double>& count) -> std::string {
+        if (not count) {
+            return "-";
+        }
+        if (*count < 1e3) {
+            return std::format("{:.0f}", *count);
+        }
+        if (*count < 1e6) {
+            return std::format("{:.2f}K", *count / 1e3);
+        }
+        if (*count < 1e9) {
+            return std::format("{:.2f}M", *count / 1e6);
+        }
+        return std::format("{:.2f}G", *count / 1e9);
+    }
+
+    auto format_bytes(double bytes) -> std::string {
+        if (bytes < 1024.0) {
+            return std::format("{:.0f} B", bytes);
+        }
+        if (bytes < 1024.0 * 1024.0) {
+            return std::format("{:.2f} KiB", bytes / 1024.0);
+        }
+        if (bytes < 1024.0 * 1024.0 * 1024.0) {
+            return std::format("{:.2f} MiB", bytes / (1024.0 * 1024.0));
+        }
+        return std::format("{:.2f} GiB", bytes / (1024.0 * 1024.0 * 1024.0));
+    }
+
+    auto has_allocations(const bench::Measurement& measurement) -> bool {
+        return measurement.statistics.allocations.has_value();
+    }
+
+    auto has_events(const bench::Measurement& measurement) -> bool {
+        return std::ranges::any_of(measurement.statistics.events, [](const auto& count) { return count.has_value(); });
+    }
+
+    auto print_events(std::ostream& stream, const std::vector<bench::Measurement>& measurements) -> void {
+        // counts are means per run
+        stream << std::format("\n{:>4}  {:<8}  {:>10}  {:>10}  {:>6}", "day", "phase", "cycles", "instr", "ipc");
+        stream << std::format("  {:>10}  {:>10}  {:>10}\n", "l1d miss", "llc miss", "br miss");
+        for (const auto& [day, phase, answer, statistics] : measurements) {
+            const auto& [cycles, instructions, l1d_misses, llc_misses, branch_misses] = statistics.events;
+
+            const auto ipc = (cycles && instructions && *cycles != 0) ? std::format("{:.2f}", *instructions / *cycles) : "-";
+            stream << std::format(
+                "{:>4}  {:<8}  {:>10}  {:>10}  {:>6}  {:>10}  {:>10}  {:>10}\n", day, phase, format_count(cycles),
+                format_count(instructions), ipc, format_count(l1d_misses), format_count(llc_misses),
+                format_count(branch_misses)
+            );
+        }
+    }
+
+    auto print_allocations(std::ostream& stream, const std::vector<bench::Measurement>& measurements) -> void {
+        // counts and bytes are means per run, the peaks are the highest of any run
+        stream << std::format(
+            "\n{:>4}  {:<8}  {:>10}  {:>12}  {:>12}  {:>12}  {:>12}\n", "day", "phase", "allocs", "heap", "peak heap",
+            "arena", "peak rss"
+        );
+        for (const auto& [day, phase, answer, statistics] : measurements) {
+            if (not statistics.allocations) {
+                continue;
+            }
+
+            const auto& [allocations, bytes, arena, peak_heap, peak_rss] = *statistics.allocations;
+            stream << std::format(
+                "{:>4}  {:<8}  {:>10}  {:>12}  {:>12}  {:>12}  {:>12}\n", day, phase, format_count(allocations),
+                format_bytes(bytes), format_bytes(static_cast<double>(peak_heap)), format_bytes(arena),
+                peak_rss ? format_bytes(static_cast<double>(*peak_rss)) : "-"
+            );
+        }
+    }
+
+    auto escape(std::string_view str) -> std::string {
+        auto escaped = std::string{};
+        for (const auto symbol : str) {
+            switch (symbol) {
+                case '"': escaped += "\\\""; break;
+                case '\\': escaped += "\\\\"; break;
+                case '\n': escaped += "\\n"; break;
+                default: escaped += symbol; break;
+            }
+        }
+        return escaped;
+    }
+}  // namespace
+
+
+namespace bench {
+    auto summarize(std::vector<double> samples) -> Statistics {
+        if (samples.empty()) {
+            return {};
+        }
+
+        std::ranges::sort(samples);
+
+        const auto count = samples.size();
+        const auto mean  = std::reduce(samples.cbegin(), samples.cend()) / static_cast<double>(count);
+        const auto sum_of_squares =
+            std::transform_reduce(samples.cbegin(), samples.cend(), 0.0, std::plus<>{}, [mean](double sample) {
+                return (sample - mean) * (sample - mean);
+            });
+
+        // nearest-rank percentile
+        const auto rank = [&](double percentile) {
+            const auto position = static_cast<std::size_t>(std::ceil(percentile * static_cast<double>(count)));
+            return samples[std::clamp(position, 1ul, count) - 1];
+        };
+
+        const auto median = (count % 2 != 0) ? samples[count / 2] : (samples[count / 2 - 1] + samples[count / 2]) / 2.0;
+        return {
+            .runs   = count,
+            .min    = samples.front(),
+            .median = median,
+            .p99    = rank(0.99),  // NOLINT: it is the 99th percentile
+            .mean   = mean,
+            .stddev = (count > 1) ? std::sqrt(sum_of_squares / static_cast<double>(count - 1)) : 0.0,
+        };
+    }
+
+    auto print_table(std::ostream& stream, const std::vector<Measurement>& measurements) -> void {
+        stream << std::format(
+            "{:>4}  {:<8}  {:>12}  {:>12}  {:>12}  {:>12}  {}\n", "day", "phase", "min", "median", "p99", "stddev", "answer"
+        );
+        for (const auto& [day, phase, answer, statistics] : measurements) {
+            stream << std::format(
+                "{:>4}  {:<8}  {:>12}  {:>12}  {:>12}  {:>12}  {}\n", day, phase, format_duration(statistics.min),
+                format_duration(statistics.median), format_duration(statistics.p99), format_duration(statistics.stddev),
+                answer
+            );
+        }
+
+        if (std::ranges::any_of(measurements, has_events)) {
+            print_events(stream, measurements);
+        }
+        if (std::ranges::any_of(measurements, has_allocations)) {
+            print_allocations(stream, measurements);
+        }
+    }
+
+    auto write_json(std::ostream& stream, const Options& options, const std::vector<Measurement>& measurements) -> void {
+        stream << "{\n";
+        stream << std::format("  \"unit\": \"ns\",\n  \"warmup\": {},\n  \"runs\": {},\n", options.warmup, options.runs);
+        stream << "  \"results\": [";
+        for (auto separator = std::string_view{"\n"}; const auto& measurement : measurements) {
+            const auto& [day, phase, answer, statistics] = measurement;
+            stream << separator;
+            stream << std::format(
+                R"(    {{"day": {}, "phase": "{}", "answer": "{}", "runs": {}, )"
+                R"("min": {:.1f}, "median": {:.1f}, "p99": {:.1f}, "mean": {:.1f}, "stddev": {:.1f})",
+                day, phase, escape(answer), statistics.runs, statistics.min, statistics.median, statistics.p99,
+                statistics.mean, statistics.stddev
+            );
+            if (has_events(measurement)) {
+                stream << R"(, "events": {)";
+                for (auto index = 0ul; index != bench::PERF_EVENT_COUNT; index++) {
+                    const auto& count = statistics.events[index];
+                    stream << std::format(
+                        R"({}"{}": {})", (index != 0) ? ", " : "", bench::PERF_EVENT_NAMES[index],
+                        count ? std::format("{:.1f}", *count) : "null"
+                    );
+                }
+                stream << "}";
+            }
+            if (const auto& allocations = statistics.allocations) {
+                stream << std::format(
+                    R"(, "allocations": {{"count": {:.1f}, "bytes": {:.1f}, "arena_bytes": {:.1f}, "peak_heap": {}, )"
+                    R"("peak_rss": {}}})",
+                    allocations->allocations, allocations->bytes, allocations->arena, allocations->peak_heap,
+                    allocations->peak_rss ? std::format("{}", *allocations->peak_rss) : "null"
+                );
+            }
+            stream << "}";
+            separator = ",\n";
+        }
+        stream << "\n  ]\n}\n";
+    }
+}  // namespace bench
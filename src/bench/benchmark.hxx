@@ -0,0 +1,168 @@
+#ifndef BENCH_BENCHMARK_HXX
+#define BENCH_BENCHMARK_HXX
+
+#include "allocations.hxx"
+#include "perf.hxx"
+
+#include <core/arena.hxx>
+#include <core/thread-pool.hxx>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+namespace bench {
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::size_t warmup      = 1;
+        std::size_t runs        = 10;
+        bool        counters    = false;  // read hardware counters in `runs` extra runs
+        bool        allocations = false;  // count heap allocations in `runs` extra runs
+    };
+
+    // all durations are in nanoseconds
+    struct Statistics {
+        std::size_t                     runs   = 0;
+        double                          min    = 0.0;
+        double                          median = 0.0;
+        double                          p99    = 0.0;
+        double                          mean   = 0.0;
+        double                          stddev = 0.0;
+        EventCounts                     events{};
+        std::optional<AllocationCounts> allocations{};
+    };
+
+    struct Measurement {
+        std::size_t      day = 0;
+        std::string_view phase;
+        std::string      answer;
+        Statistics       statistics;
+    };
+
+    // keeps the compiler from dropping a computation whose result is otherwise unused
+    template<typename T>
+    auto do_not_optimize(const T& value) -> void {
+        asm volatile("" : : "g"(&value) : "memory");
+    }
+
+    auto summarize(std::vector<double> samples) -> Statistics;
+
+    // Every run allocates its scratch memory from one arena that is reset in between, like a batch run would.
+    // Counters and allocations are collected in runs of their own after the timed ones, so they don't skew the times.
+    template<typename Function>
+    auto measure(const Options& options, Function function) -> Statistics {
+        auto arena = core::Arena{};
+
+        // the high-water mark covers the warmup too, the first run is the one that grows the arena
+        const auto rss_tracked = options.allocations && reset_peak_rss();
+
+        for (auto run = 0ul; run != options.warmup; run++) {
+            {
+                const auto scope = core::ResourceScope{arena};
+                do_not_optimize(function());
+            }
+            arena.reset();
+        }
+
+        auto samples = std::vector<double>{};
+        samples.reserve(options.runs);
+        for (auto run = 0ul; run != options.runs; run++) {
+            {
+                const auto scope  = core::ResourceScope{arena};
+                const auto start  = Clock::now();
+                const auto result = function();
+                const auto finish = Clock::now();
+
+                do_not_optimize(result);
+                samples.push_back(std::chrono::duration<double, std::nano>(finish - start).count());
+            }
+            arena.reset();
+        }
+
+        auto statistics = summarize(std::move(samples));
+
+        if (options.counters) {
+            // The counters only see the thread that opens them, so the counted runs go to a worker of a pool of
+            // its own, where core::parallel folds every chunk inline instead of handing it to other threads.
+            auto counted = core::ThreadPool{1};
+            counted.submit([&] {
+                auto counters = PerfCounters{};
+                for (auto run = 0ul; run != options.runs; run++) {
+                    {
+                        const auto scope = core::ResourceScope{arena};
+                        counters.start();
+                        const auto result = function();
+                        counters.stop();
+                        do_not_optimize(result);
+                    }
+                    arena.reset();
+                }
+                statistics.events = counters.means();
+            });
+            counted.wait();
+        }
+
+        if (options.allocations) {
+            auto allocations = AllocationTracker{};
+            for (auto run = 0ul; run != options.runs; run++) {
+                {
+                    const auto scope = core::ResourceScope{arena};
+                    allocations.start();
+                    const auto result = function();
+                    allocations.stop();
+                    do_not_optimize(result);
+                }
+                allocations.add_arena(arena.used());
+                arena.reset();
+            }
+
+            statistics.allocations = allocations.means(options.runs);
+            if (rss_tracked) {
+                statistics.allocations->peak_rss = peak_rss();
+            }
+        }
+        return statistics;
+    }
+
+    // Times parsing and every part separately; parts are measured against one parsed model.
+    template<typename Parse, typename... Parts>
+    auto measure_day(std::string_view input, const Options& options, Parse parse, Parts... parts)
+        -> std::vector<Measurement> {
+        constexpr auto PHASES = std::array<std::string_view, 2>{"part_one", "part_two"};
+        static_assert(sizeof...(Parts) <= PHASES.size());
+
+        auto measurements = std::vector<Measurement>{};
+        measurements.push_back({
+            .phase      = "parse",
+            .answer     = {},
+            .statistics = measure(options, [&] { return parse(input); }),
+        });
+
+        const auto model = parse(input);
+        auto       phase = PHASES.begin();
+        (
+            measurements.push_back({
+                .phase      = *phase++,
+                .answer     = std::format("{}", parts(model)),
+                .statistics = measure(options, [&] { return parts(model); }),
+            }),
+            ...
+        );
+
+        return measurements;
+    }
+
+    auto print_table(std::ostream& stream, const std::vector<Measurement>& measurements) -> void;
+    auto write_json(std::ostream& stream, const Options& options, const std::vector<Measurement>& measurements) -> void;
+}  // namespace bench
+
+#endif  // BENCH_BENCHMARK_HXX
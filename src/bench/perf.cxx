@@ -0,0 +1,164 @@
+#include "perf.hxx"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+namespace {
+    constexpr auto CLOSED = -1;
+
+#ifdef __linux__
+    struct PerfEvent {
+        std::uint32_t type   = 0;
+        std::uint64_t config = 0;
+    };
+
+    constexpr auto cache_miss(std::uint64_t cache) -> std::uint64_t {
+        return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);  // NOLINT
+    }
+
+    // ordered as `PERF_EVENT_NAMES`
+    constexpr auto EVENTS = std::array<PerfEvent, bench::PERF_EVENT_COUNT>{{
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HW_CACHE, cache_miss(PERF_COUNT_HW_CACHE_L1D)},
+        {PERF_TYPE_HW_CACHE, cache_miss(PERF_COUNT_HW_CACHE_LL)},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    }};
+
+    // layout of a read() with PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING
+    struct Reading {
+        std::uint64_t value   = 0;
+        std::uint64_t enabled = 0;
+        std::uint64_t running = 0;
+    };
+
+    auto read_event(int descriptor) -> std::optional<Reading> {
+        auto reading = Reading{};
+        if (::read(descriptor, &reading, sizeof(reading)) != sizeof(reading)) {
+            return std::nullopt;
+        }
+        return reading;
+    }
+
+    auto open_event(const PerfEvent& event) -> int {
+        auto attributes           = perf_event_attr{};
+        attributes.size           = sizeof(attributes);
+        attributes.type           = event.type;
+        attributes.config         = event.config;
+        attributes.disabled       = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv     = 1;
+        attributes.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        // this thread, any CPU, no group
+        return static_cast<int>(::syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+    }
+#endif
+}  // namespace
+
+
+namespace bench {
+    const std::array<std::string_view, PERF_EVENT_COUNT> PERF_EVENT_NAMES = {
+        "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses",
+    };
+
+    PerfCounters::PerfCounters() {
+        descriptors_.fill(CLOSED);
+
+#ifdef __linux__
+        for (auto index = 0ul; index != PERF_EVENT_COUNT; index++) {
+            descriptors_[index] = open_event(EVENTS[index]);
+            if (descriptors_[index] == CLOSED && error_.empty()) {
+                error_ = std::format("{}: {}", PERF_EVENT_NAMES[index], std::strerror(errno));
+            }
+        }
+#else
+        error_ = "hardware counters need Linux perf_event_open";
+#endif
+    }
+
+    PerfCounters::~PerfCounters() {
+#ifdef __linux__
+        for (const auto descriptor : descriptors_) {
+            if (descriptor != CLOSED) {
+                ::close(descriptor);
+            }
+        }
+#endif
+    }
+
+    auto PerfCounters::available() const -> bool {
+        return std::ranges::any_of(descriptors_, [](int descriptor) { return descriptor != CLOSED; });
+    }
+
+    auto PerfCounters::start() -> void {
+#ifdef __linux__
+        for (auto index = 0ul; index != PERF_EVENT_COUNT; index++) {
+            const auto descriptor = descriptors_[index];
+            if (descriptor == CLOSED) {
+                continue;
+            }
+
+            // a reset only clears the count, the enabled and running times keep adding up since the open
+            ::ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+            const auto reading = read_event(descriptor).value_or(Reading{});
+            started_[index]    = {reading.value, reading.enabled, reading.running};
+            ::ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    auto PerfCounters::stop() -> void {
+#ifdef __linux__
+        for (const auto descriptor : descriptors_) {
+            if (descriptor != CLOSED) {
+                ::ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+
+        for (auto index = 0ul; index != PERF_EVENT_COUNT; index++) {
+            const auto reading = (descriptors_[index] != CLOSED) ? read_event(descriptors_[index]) : std::nullopt;
+            if (not reading) {
+                continue;
+            }
+
+            const auto& [value, enabled, running] = started_[index];
+            if (reading->running == running) {
+                continue;  // never on the PMU during this run, there is nothing to extrapolate from
+            }
+
+            // the kernel multiplexes counters when there are more than the PMU has, extrapolate to the whole run
+            const auto scale = static_cast<double>(reading->enabled - enabled)
+                             / static_cast<double>(reading->running - running);
+            totals_[index] += static_cast<double>(reading->value - value) * scale;
+            counted_[index]++;
+        }
+#endif
+    }
+
+    auto PerfCounters::means() const -> EventCounts {
+        auto counts = EventCounts{};
+        for (auto index = 0ul; index != PERF_EVENT_COUNT; index++) {
+            if (counted_[index] != 0) {
+                counts[index] = totals_[index] / static_cast<double>(counted_[index]);
+            }
+        }
+        return counts;
+    }
+}  // namespace bench
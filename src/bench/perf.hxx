@@ -0,0 +1,67 @@
+#ifndef BENCH_PERF_HXX
+#define BENCH_PERF_HXX
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+
+namespace bench {
+    constexpr auto PERF_EVENT_COUNT = std::size_t{5};
+
+    // cycles, instructions, L1 data read misses, last level cache misses and branch misses
+    extern const std::array<std::string_view, PERF_EVENT_COUNT> PERF_EVENT_NAMES;
+
+    // mean count per run, empty when the counter couldn't be opened or never got on the PMU
+    using EventCounts = std::array<std::optional<double>, PERF_EVENT_COUNT>;
+
+    // Linux perf_event_open counters of the calling thread, user space only. Work handed to other threads is missed.
+    //
+    // Every event is opened on its own, so a PMU that lacks one of them (or a VM that exposes none) only loses
+    // those columns. Counters multiplexed by the kernel are scaled by their enabled/running time.
+    class PerfCounters {
+    public:
+        PerfCounters();
+
+        PerfCounters(const PerfCounters&) = delete;
+        PerfCounters(PerfCounters&&)      = delete;
+
+        auto operator=(const PerfCounters&) -> PerfCounters& = delete;
+        auto operator=(PerfCounters&&) -> PerfCounters&      = delete;
+
+        ~PerfCounters();
+
+        // true if at least one counter could be opened
+        [[nodiscard]] auto available() const -> bool;
+
+        // why the first counter failed to open (e.g. perf_event_paranoid), empty if all of them are open
+        [[nodiscard]] auto error() const -> const std::string& {
+            return error_;
+        }
+
+        auto start() -> void;
+        auto stop() -> void;
+
+        // averages of everything counted between `start` and `stop` calls, over the runs a counter was scheduled in
+        [[nodiscard]] auto means() const -> EventCounts;
+
+    private:
+        // count, time enabled and time running at the last `start`, in nanoseconds
+        struct Snapshot {
+            std::uint64_t value   = 0;
+            std::uint64_t enabled = 0;
+            std::uint64_t running = 0;
+        };
+
+        std::array<int, PERF_EVENT_COUNT>         descriptors_{};
+        std::array<Snapshot, PERF_EVENT_COUNT>    started_{};
+        std::array<double, PERF_EVENT_COUNT>      totals_{};
+        std::array<std::size_t, PERF_EVENT_COUNT> counted_{};
+        std::string                               error_;
+    };
+}  // namespace bench
+
+#endif  // BENCH_PERF_HXX
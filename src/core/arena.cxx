@@ -0,0 +1,96 @@
+#include <core/arena.hxx>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <utility>
+
+
+namespace core {
+    namespace {
+        thread_local std::pmr::memory_resource* current_resource = nullptr;
+    }  // namespace
+
+    Arena::Arena(std::size_t block_size, std::pmr::memory_resource* upstream)
+        : upstream_{upstream}
+        , block_size_{std::max(block_size, alignof(std::max_align_t))} {}
+
+    Arena::~Arena() {
+        for (const auto& block : blocks_) {
+            upstream_->deallocate(block.data, block.size, alignof(std::max_align_t));
+        }
+    }
+
+    auto Arena::reset() -> void {
+        current_ = 0;
+        cursor_  = blocks_.empty() ? nullptr : blocks_.front().data;
+        end_     = blocks_.empty() ? nullptr : blocks_.front().data + blocks_.front().size;
+        used_    = 0;
+    }
+
+    auto Arena::capacity() const -> std::size_t {
+        return std::transform_reduce(blocks_.begin(), blocks_.end(), std::size_t{0}, std::plus<>{}, [](const Block& block) {
+            return block.size;
+        });
+    }
+
+    auto Arena::do_allocate(std::size_t bytes, std::size_t alignment) -> void* {
+        void* pointer = cursor_;
+        auto  space   = static_cast<std::size_t>(end_ - cursor_);
+        if (cursor_ == nullptr || std::align(alignment, bytes, pointer, space) == nullptr) {
+            next_block(bytes + alignment);
+
+            pointer = cursor_;
+            space   = static_cast<std::size_t>(end_ - cursor_);
+            std::align(alignment, bytes, pointer, space);
+        }
+
+        cursor_ = static_cast<std::byte*>(pointer) + bytes;
+        used_ += bytes;
+        return pointer;
+    }
+
+    auto Arena::do_deallocate(void* /*pointer*/, std::size_t /*bytes*/, std::size_t /*alignment*/) -> void {
+        // memory is given back all at once by `reset`
+    }
+
+    auto Arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool {
+        return this == &other;
+    }
+
+    auto Arena::next_block(std::size_t min_size) -> void {
+        // reuse the blocks kept from previous runs first, skipping the ones that are too small
+        if (not blocks_.empty()) {
+            current_++;
+        }
+        while (current_ < blocks_.size() && blocks_[current_].size < min_size) {
+            current_++;
+        }
+
+        if (current_ == blocks_.size()) {
+            // every new block doubles the previous one to keep the number of blocks logarithmic
+            const auto size = std::max(min_size, blocks_.empty() ? block_size_ : 2 * blocks_.back().size);
+            blocks_.push_back({
+                .data = static_cast<std::byte*>(upstream_->allocate(size, alignof(std::max_align_t))),
+                .size = size,
+            });
+        }
+
+        cursor_ = blocks_[current_].data;
+        end_    = blocks_[current_].data + blocks_[current_].size;
+    }
+
+    auto memory_resource() -> std::pmr::memory_resource* {
+        return (current_resource != nullptr) ? current_resource : std::pmr::get_default_resource();
+    }
+
+    ResourceScope::ResourceScope(std::pmr::memory_resource& resource)
+        : previous_{std::exchange(current_resource, &resource)} {}
+
+    ResourceScope::~ResourceScope() {
+        current_resource = previous_;
+    }
+}  // namespace core
@@ -0,0 +1,91 @@
+#ifndef CORE_ARENA_HXX
+#define CORE_ARENA_HXX
+
+#include <cstddef>
+#include <deque>
+#include <memory_resource>
+#include <queue>
+#include <vector>
+
+
+namespace core {
+    // Monotonic memory resource: allocation bumps a pointer, deallocation is a no-op and `reset` drops
+    // everything at once. Blocks taken from the upstream are kept across resets, so a solver that runs
+    // over and over again stops touching the system allocator after the first run.
+    class Arena : public std::pmr::memory_resource {
+    public:
+        static constexpr auto DEFAULT_BLOCK_SIZE = std::size_t{64 * 1024};
+
+    public:
+        explicit Arena(
+            std::size_t block_size = DEFAULT_BLOCK_SIZE, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()
+        );
+
+        Arena(const Arena&) = delete;
+        Arena(Arena&&)      = delete;
+
+        auto operator=(const Arena&) -> Arena& = delete;
+        auto operator=(Arena&&) -> Arena&      = delete;
+
+        ~Arena() override;
+
+        // invalidates everything allocated so far, but keeps the blocks for reuse
+        auto reset() -> void;
+
+        // bytes handed out since the last reset
+        [[nodiscard]] auto used() const -> std::size_t {
+            return used_;
+        }
+
+        // bytes taken from the upstream resource
+        [[nodiscard]] auto capacity() const -> std::size_t;
+
+    private:
+        struct Block {
+            std::byte*  data = nullptr;
+            std::size_t size = 0;
+        };
+
+        auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override;
+        auto do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) -> void override;
+        auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override;
+
+        auto next_block(std::size_t min_size) -> void;
+
+    private:
+        std::pmr::memory_resource* upstream_;
+        std::size_t                block_size_;
+        std::vector<Block>         blocks_;
+        std::size_t                current_ = 0;
+        std::byte*                 cursor_  = nullptr;
+        std::byte*                 end_     = nullptr;
+        std::size_t                used_    = 0;
+    };
+
+    // Resource the solvers build their scratch containers on: the default resource unless a `ResourceScope`
+    // is active on the calling thread.
+    [[nodiscard]] auto memory_resource() -> std::pmr::memory_resource*;
+
+    // FIFO queue whose nodes come from a memory resource, build it as `Queue<T>{memory_resource()}`
+    template<typename T>
+    using Queue = std::queue<T, std::pmr::deque<T>>;
+
+    // Routes `memory_resource()` of the calling thread to `resource` until the scope ends.
+    class ResourceScope {
+    public:
+        explicit ResourceScope(std::pmr::memory_resource& resource);
+
+        ResourceScope(const ResourceScope&) = delete;
+        ResourceScope(ResourceScope&&)      = delete;
+
+        auto operator=(const ResourceScope&) -> ResourceScope& = delete;
+        auto operator=(ResourceScope&&) -> ResourceScope&      = delete;
+
+        ~ResourceScope();
+
+    private:
+        std::pmr::memory_resource* previous_;
+    };
+}  // namespace core
+
+#endif  // CORE_ARENA_HXX
@@ -0,0 +1,319 @@
+#include <core/bit-grid.hxx>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define CORE_BITS_X86 1
+#endif
+
+
+namespace core {
+    namespace {
+        using Word  = BitGrid::Word;
+        using Index = BitGrid::Index;
+
+        enum class Operation : std::uint8_t {
+            OR,
+            AND,
+            XOR,
+            AND_NOT,
+        };
+
+        using CombineKernel = void (*)(Operation operation, Word* target, const Word* source, std::size_t size);
+        using CountKernel   = std::size_t (*)(const Word* words, std::size_t size);
+
+        struct Kernels {
+            std::string_view name;
+            CombineKernel    combine = nullptr;
+            CountKernel      count   = nullptr;
+        };
+
+        auto combine_scalar(Operation operation, Word* target, const Word* source, std::size_t size) -> void {
+            switch (operation) {
+                case Operation::OR:
+                    for (auto i = 0ul; i != size; i++) {
+                        target[i] |= source[i];
+                    }
+                    break;
+                case Operation::AND:
+                    for (auto i = 0ul; i != size; i++) {
+                        target[i] &= source[i];
+                    }
+                    break;
+                case Operation::XOR:
+                    for (auto i = 0ul; i != size; i++) {
+                        target[i] ^= source[i];
+                    }
+                    break;
+                case Operation::AND_NOT:
+                    for (auto i = 0ul; i != size; i++) {
+                        target[i] &= ~source[i];
+                    }
+                    break;
+            }
+        }
+
+        auto count_scalar(const Word* words, std::size_t size) -> std::size_t {
+            auto total = std::size_t{0};
+            for (auto i = 0ul; i != size; i++) {
+                total += static_cast<std::size_t>(std::popcount(words[i]));
+            }
+            return total;
+        }
+
+#ifdef CORE_BITS_X86
+        constexpr auto AVX2_WORDS = 4ul;
+
+        __attribute__((target("avx2"))) auto combine_avx2(
+            Operation operation, Word* target, const Word* source, std::size_t size
+        ) -> void {
+            auto offset = 0ul;
+            for (; offset + AVX2_WORDS <= size; offset += AVX2_WORDS) {
+                auto* const       lhs_address = reinterpret_cast<__m256i*>(target + offset);        // NOLINT
+                const auto* const rhs_address = reinterpret_cast<const __m256i*>(source + offset);  // NOLINT
+
+                const auto lhs = _mm256_loadu_si256(lhs_address);
+                const auto rhs = _mm256_loadu_si256(rhs_address);
+                switch (operation) {
+                    case Operation::OR:
+                        _mm256_storeu_si256(lhs_address, _mm256_or_si256(lhs, rhs));
+                        break;
+                    case Operation::AND:
+                        _mm256_storeu_si256(lhs_address, _mm256_and_si256(lhs, rhs));
+                        break;
+                    case Operation::XOR:
+                        _mm256_storeu_si256(lhs_address, _mm256_xor_si256(lhs, rhs));
+                        break;
+                    case Operation::AND_NOT:
+                        _mm256_storeu_si256(lhs_address, _mm256_andnot_si256(rhs, lhs));
+                        break;
+                }
+            }
+
+            combine_scalar(operation, target + offset, source + offset, size - offset);
+        }
+
+        // nibble lookup popcount (Mula et al.), x86-64 baseline has no popcnt instruction to fall back on
+        __attribute__((target("avx2"))) auto count_avx2(const Word* words, std::size_t size) -> std::size_t {
+            const auto lookup = _mm256_setr_epi8(
+                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+            );
+            const auto low_nibbles = _mm256_set1_epi8(0x0f);
+
+            auto totals = _mm256_setzero_si256();
+            auto offset = 0ul;
+            for (; offset + AVX2_WORDS <= size; offset += AVX2_WORDS) {
+                const auto chunk  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + offset));  // NOLINT
+                const auto low    = _mm256_and_si256(chunk, low_nibbles);
+                const auto high   = _mm256_and_si256(_mm256_srli_epi16(chunk, 4), low_nibbles);
+                const auto counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+                totals            = _mm256_add_epi64(totals, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+            }
+
+            auto lanes = std::array<std::uint64_t, AVX2_WORDS>{};
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes.data()), totals);  // NOLINT
+
+            auto total = std::size_t{0};
+            for (const auto lane : lanes) {
+                total += lane;
+            }
+            return total + count_scalar(words + offset, size - offset);
+        }
+#endif
+
+        auto select_kernels() -> Kernels {
+#ifdef CORE_BITS_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) {
+                return {"avx2", combine_avx2, count_avx2};
+            }
+#endif
+            return {"scalar", combine_scalar, count_scalar};
+        }
+
+        auto kernels() -> const Kernels& {
+            static const auto selected = select_kernels();
+            return selected;
+        }
+
+        auto check_dimensions(const BitGrid& lhs, const BitGrid& rhs) -> void {
+            if (lhs.rows() != rhs.rows() || lhs.cols() != rhs.cols()) {
+                throw std::invalid_argument("Bit grids have different dimensions");
+            }
+        }
+
+        // Transposes a 64x64 bit block in place by swapping ever smaller off-diagonal blocks (Hacker's Delight 7-3).
+        auto transpose_block(std::array<Word, BitGrid::WORD_BITS>& block) -> void {
+            auto mask = Word{0x0000'0000'FFFF'FFFF};
+            for (auto width = 32ul; width != 0; width >>= 1, mask ^= mask << width) {
+                for (auto k = 0ul; k < block.size(); k = ((k | width) + 1) & ~width) {
+                    const auto swapped = ((block[k] >> width) ^ block[k | width]) & mask;
+                    block[k] ^= swapped << width;
+                    block[k | width] ^= swapped;
+                }
+            }
+        }
+    }  // namespace
+
+
+    BitGrid::BitGrid(Index rows, Index cols)
+        : rows_{rows}
+        , cols_{cols}
+        , stride_{(cols + WORD_BITS - 1) / WORD_BITS}
+        , words_(static_cast<std::size_t>(rows * stride_), 0) {}
+
+    auto BitGrid::clear() -> void {
+        std::ranges::fill(words_, Word{0});
+    }
+
+    auto BitGrid::count() const -> std::size_t {
+        return kernels().count(words_.data(), words_.size());
+    }
+
+    auto BitGrid::count_row(Index row) const -> std::size_t {
+        return kernels().count(words_.data() + row * stride_, static_cast<std::size_t>(stride_));
+    }
+
+    auto BitGrid::any() const -> bool {
+        return std::ranges::any_of(words_, [](Word word) { return word != 0; });
+    }
+
+    auto BitGrid::operator|=(const BitGrid& other) -> BitGrid& {
+        check_dimensions(*this, other);
+        kernels().combine(Operation::OR, words_.data(), other.words_.data(), words_.size());
+        return *this;
+    }
+
+    auto BitGrid::operator&=(const BitGrid& other) -> BitGrid& {
+        check_dimensions(*this, other);
+        kernels().combine(Operation::AND, words_.data(), other.words_.data(), words_.size());
+        return *this;
+    }
+
+    auto BitGrid::operator^=(const BitGrid& other) -> BitGrid& {
+        check_dimensions(*this, other);
+        kernels().combine(Operation::XOR, words_.data(), other.words_.data(), words_.size());
+        return *this;
+    }
+
+    auto BitGrid::and_not(const BitGrid& other) -> BitGrid& {
+        check_dimensions(*this, other);
+        kernels().combine(Operation::AND_NOT, words_.data(), other.words_.data(), words_.size());
+        return *this;
+    }
+
+    auto BitGrid::shifted(Coordinate offset) const -> BitGrid {
+        auto result = BitGrid{rows_, cols_};
+        if (offset.row <= -rows_ || offset.row >= rows_ || offset.col <= -cols_ || offset.col >= cols_) {
+            return result;
+        }
+
+        const auto whole = std::abs(offset.col) / WORD_BITS;
+        const auto part  = static_cast<int>(std::abs(offset.col) % WORD_BITS);
+
+        // word `index` of a source row, zero past either end
+        const auto at = [this](std::span<const Word> source, Index index) -> Word {
+            return (index >= 0 && index < stride_) ? source[static_cast<std::size_t>(index)] : Word{0};
+        };
+
+        for (auto row = std::max(Index{0}, offset.row); row < std::min(rows_, rows_ + offset.row); row++) {
+            const auto source = this->row(row - offset.row);
+            auto       target = result.row(row);
+            for (auto index = Index{0}; index != stride_; index++) {
+                auto word = Word{0};
+                if (offset.col >= 0) {
+                    // towards higher columns, the carry comes from the word below
+                    word = at(source, index - whole) << part;
+                    if (part != 0) {
+                        word |= at(source, index - whole - 1) >> (WORD_BITS - part);
+                    }
+                } else {
+                    word = at(source, index + whole) >> part;
+                    if (part != 0) {
+                        word |= at(source, index + whole + 1) << (WORD_BITS - part);
+                    }
+                }
+                target[static_cast<std::size_t>(index)] = word;
+            }
+            target.back() &= tail_mask();
+        }
+
+        return result;
+    }
+
+    auto BitGrid::dilated() const -> BitGrid {
+        auto result = BitGrid{rows_, cols_};
+        for (auto row = Index{0}; row != rows_; row++) {
+            const auto current = this->row(row);
+            auto       target  = result.row(row);
+            for (auto index = 0ul; index != current.size(); index++) {
+                const auto word = current[index];
+
+                auto spread = word | (word << 1) | (word >> 1);
+                if (index != 0) {
+                    spread |= current[index - 1] >> (WORD_BITS - 1);
+                }
+                if (index + 1 != current.size()) {
+                    spread |= current[index + 1] << (WORD_BITS - 1);
+                }
+                if (row != 0) {
+                    spread |= this->row(row - 1)[index];
+                }
+                if (row + 1 != rows_) {
+                    spread |= this->row(row + 1)[index];
+                }
+                target[index] = spread;
+            }
+            if (not target.empty()) {
+                target.back() &= tail_mask();
+            }
+        }
+        return result;
+    }
+
+    auto BitGrid::transposed() const -> BitGrid {
+        auto result = BitGrid{cols_, rows_};
+
+        auto block = std::array<Word, WORD_BITS>{};
+        for (auto first_row = Index{0}; first_row < rows_; first_row += WORD_BITS) {
+            const auto block_rows = std::min(WORD_BITS, rows_ - first_row);
+            for (auto word = Index{0}; word != stride_; word++) {
+                block.fill(0);
+                for (auto row = Index{0}; row != block_rows; row++) {
+                    block[static_cast<std::size_t>(row)] = this->row(first_row + row)[static_cast<std::size_t>(word)];
+                }
+
+                transpose_block(block);
+
+                // row `row` of the block becomes column `row` of the result, the bits past `rows_` stay clear
+                const auto block_cols = std::min(WORD_BITS, cols_ - word * WORD_BITS);
+                for (auto col = Index{0}; col != block_cols; col++) {
+                    result.row(word * WORD_BITS + col)[static_cast<std::size_t>(first_row / WORD_BITS)] =
+                        block[static_cast<std::size_t>(col)];
+                }
+            }
+        }
+
+        return result;
+    }
+
+    auto BitGrid::tail_mask() const -> Word {
+        const auto used = cols_ % WORD_BITS;
+        return (used == 0) ? ~Word{0} : (Word{1} << used) - 1;
+    }
+
+    namespace bits {
+        auto kernel_name() -> std::string_view {
+            return kernels().name;
+        }
+    }  // namespace bits
+}  // namespace core
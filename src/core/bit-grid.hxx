@@ -0,0 +1,147 @@
+#ifndef CORE_BIT_GRID_HXX
+#define CORE_BIT_GRID_HXX
+
+#include <core/coordinate.hxx>
+#include <core/grid.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+
+namespace core {
+    // One bit per cell, every row packed into whole 64-bit words (column `c` is bit `c % 64` of word `c / 64`).
+    //
+    // Set operations and counting work a word at a time over the whole grid, with AVX2 kernels where the CPU
+    // has them. The bits past the last column are always clear, so shifts never bring in phantom cells.
+    class BitGrid {
+    public:
+        using Word  = std::uint64_t;
+        using Index = std::int64_t;
+
+        static constexpr auto WORD_BITS = Index{64};
+
+    public:
+        BitGrid() = default;
+        BitGrid(Index rows, Index cols);
+
+        // cells of `grid` (border excluded) for which `predicate` holds
+        template<typename T, typename Predicate>
+        static auto select(const Grid2D<T>& grid, Predicate predicate) -> BitGrid {
+            auto bits = BitGrid{grid.rows(), grid.cols()};
+            for (auto row = Index{0}; row != grid.rows(); row++) {
+                const auto cells = grid.row(row);
+                for (auto col = Index{0}; col != grid.cols(); col++) {
+                    if (predicate(cells[static_cast<std::size_t>(col)])) {
+                        bits.set({row, col});
+                    }
+                }
+            }
+            return bits;
+        }
+
+        [[nodiscard]] auto rows() const -> Index {
+            return rows_;
+        }
+
+        [[nodiscard]] auto cols() const -> Index {
+            return cols_;
+        }
+
+        [[nodiscard]] auto words_per_row() const -> Index {
+            return stride_;
+        }
+
+        [[nodiscard]] auto contains(Coordinate position) const -> bool {
+            return position.row >= 0 && position.col >= 0 && position.row < rows_ && position.col < cols_;
+        }
+
+        [[nodiscard]] auto test(Coordinate position) const -> bool {
+            return ((word(position) >> bit(position)) & 1u) != 0;
+        }
+
+        auto set(Coordinate position) -> void {
+            word(position) |= Word{1} << bit(position);
+        }
+
+        auto reset(Coordinate position) -> void {
+            word(position) &= ~(Word{1} << bit(position));
+        }
+
+        // sets the bit and tells whether it was clear before
+        auto insert(Coordinate position) -> bool {
+            const auto mask     = Word{1} << bit(position);
+            auto&      target   = word(position);
+            const auto inserted = (target & mask) == 0;
+            target |= mask;
+            return inserted;
+        }
+
+        auto clear() -> void;
+
+        [[nodiscard]] auto row(Index row) -> std::span<Word> {
+            return {words_.data() + row * stride_, static_cast<std::size_t>(stride_)};
+        }
+
+        [[nodiscard]] auto row(Index row) const -> std::span<const Word> {
+            return {words_.data() + row * stride_, static_cast<std::size_t>(stride_)};
+        }
+
+        [[nodiscard]] auto words() const -> std::span<const Word> {
+            return words_;
+        }
+
+        // number of set cells
+        [[nodiscard]] auto count() const -> std::size_t;
+        [[nodiscard]] auto count_row(Index row) const -> std::size_t;
+        [[nodiscard]] auto any() const -> bool;
+
+        // both grids must have the same dimensions
+        auto operator|=(const BitGrid& other) -> BitGrid&;
+        auto operator&=(const BitGrid& other) -> BitGrid&;
+        auto operator^=(const BitGrid& other) -> BitGrid&;
+        auto and_not(const BitGrid& other) -> BitGrid&;
+
+        // Every cell moved by `offset`, cells moved off the grid are lost and the vacated ones are clear.
+        [[nodiscard]] auto shifted(Coordinate offset) const -> BitGrid;
+
+        // the set cells plus their orthogonal neighbours
+        [[nodiscard]] auto dilated() const -> BitGrid;
+
+        [[nodiscard]] auto transposed() const -> BitGrid;
+
+        auto operator==(const BitGrid& other) const -> bool = default;
+
+    private:
+        [[nodiscard]] auto word(Coordinate position) -> Word& {
+            return words_[static_cast<std::size_t>(position.row * stride_ + position.col / WORD_BITS)];
+        }
+
+        [[nodiscard]] auto word(Coordinate position) const -> Word {
+            return words_[static_cast<std::size_t>(position.row * stride_ + position.col / WORD_BITS)];
+        }
+
+        [[nodiscard]] static auto bit(Coordinate position) -> int {
+            return static_cast<int>(position.col % WORD_BITS);
+        }
+
+        // the bits of the last word of a row that belong to the grid
+        [[nodiscard]] auto tail_mask() const -> Word;
+
+    private:
+        Index             rows_   = 0;
+        Index             cols_   = 0;
+        Index             stride_ = 0;  // words per row
+        std::vector<Word> words_;
+    };
+
+    namespace bits {
+        // name of the kernel picked for the word operations of `BitGrid`, handy for benchmark reports
+        auto kernel_name() -> std::string_view;
+    }  // namespace bits
+}  // namespace core
+
+
+#endif  // CORE_BIT_GRID_HXX
@@ -0,0 +1,72 @@
+#ifndef CORE_BUCKET_QUEUE_HXX
+#define CORE_BUCKET_QUEUE_HXX
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+namespace core {
+    // Monotone priority queue for shortest path searches with small non-negative integer weights. It hands out the
+    // smallest key first and requires every pushed key to be at least the key popped last, which holds whenever
+    // a popped distance is extended by a non-negative edge weight. Values with equal keys come out in any order.
+    //
+    // Dial's circular buckets for weights up to `max_weight`: one bucket per key in [last popped, last popped +
+    // max_weight], so push and pop are O(1) amortized and pop scans at most `max_weight + 1` buckets.
+    template<typename T>
+    class BucketQueue {
+    public:
+        using Key = std::uint64_t;
+
+    public:
+        explicit BucketQueue(Key max_weight)
+            : buckets_(static_cast<std::size_t>(max_weight) + 1) {}
+
+        [[nodiscard]] auto empty() const -> bool {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] auto size() const -> std::size_t {
+            return size_;
+        }
+
+        auto push(Key key, T value) -> void {
+            if (key < current_ || key - current_ >= buckets_.size()) {
+                throw std::out_of_range("BucketQueue: key outside of the bucket window");
+            }
+            buckets_[key % buckets_.size()].push_back(std::move(value));
+            size_++;
+        }
+
+        // the smallest key and one of its values, the queue must not be empty
+        auto pop() -> std::pair<Key, T> {
+            while (buckets_[current_ % buckets_.size()].empty()) {
+                current_++;
+            }
+
+            auto& bucket = buckets_[current_ % buckets_.size()];
+            auto  value  = std::move(bucket.back());
+            bucket.pop_back();
+            size_--;
+            return {current_, std::move(value)};
+        }
+
+        // keeps the buckets' memory for the next search
+        auto clear() -> void {
+            for (auto& bucket : buckets_) {
+                bucket.clear();
+            }
+            current_ = 0;
+            size_    = 0;
+        }
+
+    private:
+        std::vector<std::vector<T>> buckets_;
+        Key                         current_ = 0;  // no key below it is left
+        std::size_t                 size_    = 0;
+    };
+}  // namespace core
+
+#endif  // CORE_BUCKET_QUEUE_HXX
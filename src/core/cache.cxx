@@ -0,0 +1,135 @@
+#include <core/cache.hxx>
+
+#include <core/hash.hxx>
+#include <core/io.hxx>
+
+#include <unistd.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <ios>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+
+namespace core::cache {
+    namespace {
+        // bumped whenever the header or the layout rules above change
+        constexpr auto FORMAT_VERSION = std::uint32_t{1};
+        constexpr auto MAGIC          = std::array<char, 8>{'a', 'o', 'c', 'c', 'a', 'c', 'h', 'e'};
+
+        struct Header {
+            std::array<char, 8> magic        = MAGIC;
+            std::uint32_t       format       = FORMAT_VERSION;
+            std::uint32_t       schema       = 0;
+            std::uint64_t       input_hash   = 0;
+            std::uint64_t       payload_size = 0;
+            std::uint64_t       payload_hash = 0;  // catches truncated or damaged entries
+        };
+
+        static_assert(sizeof(Header) % 8 == 0, "the payload has to stay 8-byte aligned");
+
+        auto hash_bytes(std::span<const std::byte> bytes) -> std::uint64_t {
+            return content_hash({reinterpret_cast<const char*>(bytes.data()), bytes.size()});  // NOLINT
+        }
+    }  // namespace
+
+    auto content_hash(std::string_view input) -> std::uint64_t {
+        auto hash = hash::mix(input.size());
+
+        auto offset = 0ul;
+        for (; offset + sizeof(std::uint64_t) <= input.size(); offset += sizeof(std::uint64_t)) {
+            auto word = std::uint64_t{0};
+            std::memcpy(&word, input.data() + offset, sizeof(word));
+            hash = hash::combine(hash, word);
+        }
+
+        auto tail = std::uint64_t{0};
+        if (offset != input.size()) {
+            std::memcpy(&tail, input.data() + offset, input.size() - offset);
+        }
+        return hash::combine(hash, tail);
+    }
+
+    Store::Store(std::filesystem::path directory)
+        : directory_{std::move(directory)} {
+        std::filesystem::create_directories(directory_);
+    }
+
+    auto Store::path(std::string_view key, std::uint64_t hash) const -> std::filesystem::path {
+        return directory_ / std::format("{}-{:016x}.bin", key, hash);
+    }
+
+    auto Store::open(std::string_view key, std::uint32_t schema, std::uint64_t hash) const
+        -> std::optional<io::MappedFile> {
+        const auto file = path(key, hash);
+        if (auto error = std::error_code{}; not std::filesystem::is_regular_file(file, error)) {
+            return std::nullopt;
+        }
+
+        auto entry = io::MappedFile{file};
+        if (entry.size() < sizeof(Header)) {
+            return std::nullopt;
+        }
+
+        auto header = Header{};
+        std::memcpy(&header, entry.data(), sizeof(header));
+
+        const auto bytes = payload(entry);
+        if (header.magic != MAGIC || header.format != FORMAT_VERSION || header.schema != schema
+            || header.input_hash != hash || header.payload_size != bytes.size() || header.payload_hash != hash_bytes(bytes)) {
+            return std::nullopt;
+        }
+        return entry;
+    }
+
+    auto Store::payload(const io::MappedFile& entry) -> std::span<const std::byte> {
+        return std::as_bytes(entry.span()).subspan(sizeof(Header));
+    }
+
+    auto Store::store(std::string_view key, std::uint32_t schema, std::uint64_t hash, std::span<const std::byte> payload) const
+        -> void {
+        const auto header = Header{
+            .schema       = schema,
+            .input_hash   = hash,
+            .payload_size = payload.size(),
+            .payload_hash = hash_bytes(payload),
+        };
+
+        // unique per process and thread, batch workers may save the same input at once
+        const auto target    = path(key, hash);
+        const auto thread    = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        const auto temporary = std::filesystem::path{std::format("{}.{}-{:x}.tmp", target.string(), ::getpid(), thread)};
+        // the model at hand is good either way, a failed save only costs the next run a parse
+        const auto fail = [&](std::string_view reason) {
+            auto ignored = std::error_code{};
+            std::filesystem::remove(temporary, ignored);
+            std::cerr << std::format("Failed to cache {}: {}, continuing without it\n", target.string(), reason);
+        };
+
+        {
+            auto stream = std::ofstream{temporary, std::ios::binary | std::ios::trunc};
+            stream.write(reinterpret_cast<const char*>(&header), sizeof(header));  // NOLINT
+            stream.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));  // NOLINT
+            if (not stream.flush()) {
+                fail("the entry couldn't be written");
+                return;
+            }
+        }
+
+        if (auto error = std::error_code{}; std::filesystem::rename(temporary, target, error), error) {
+            fail(error.message());
+        }
+    }
+}  // namespace core::cache
@@ -0,0 +1,164 @@
+#ifndef CORE_CACHE_HXX
+#define CORE_CACHE_HXX
+
+#include <core/io.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+
+// Parsed models saved next to nothing but a hash of the text they came from, so a later run on the same input
+// maps the file and copies the model out instead of parsing it again.
+//
+// An entry is a fixed header followed by the payload the day wrote. Everything is 8-byte aligned in native byte
+// order: the cache is local to the machine that wrote it. Entries are keyed by the content hash of the input, so an
+// edited input simply misses; a day bumps its schema whenever its model or its serialization changes.
+namespace core::cache {
+    // fast 64-bit hash of the whole input, not meant to resist anyone
+    [[nodiscard]] auto content_hash(std::string_view input) -> std::uint64_t;
+
+    // Appends values to a growing payload. Spans and strings are prefixed by their length.
+    class Writer {
+    public:
+        template<typename T>
+        auto write(const T& value) -> void {
+            static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable values can be written as bytes");
+            append(&value, sizeof(T));
+        }
+
+        template<typename T, std::size_t Extent>
+        auto write_span(std::span<T, Extent> values) -> void {
+            static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable values can be written as bytes");
+            static_assert(alignof(T) <= ALIGNMENT, "the payload is only 8-byte aligned");
+            write(static_cast<std::uint64_t>(values.size()));
+            append(values.data(), values.size_bytes());
+        }
+
+        auto write_string(std::string_view str) -> void {
+            write_span(std::span{str});
+        }
+
+        [[nodiscard]] auto bytes() const -> std::span<const std::byte> {
+            return buffer_;
+        }
+
+    private:
+        static constexpr auto ALIGNMENT = std::size_t{8};
+
+        // every value starts 8-byte aligned, so a reader can hand out spans straight into the mapping
+        auto append(const void* data, std::size_t size) -> void {
+            const auto offset = buffer_.size();
+            buffer_.resize(offset + (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT);
+            if (size != 0) {
+                std::memcpy(buffer_.data() + offset, data, size);
+            }
+        }
+
+    private:
+        std::vector<std::byte> buffer_;
+    };
+
+    // Reads back what a `Writer` wrote, in the same order. Spans and strings point into the entry.
+    class Reader {
+    public:
+        explicit Reader(std::span<const std::byte> bytes)
+            : bytes_{bytes} {}
+
+        template<typename T>
+        auto read() -> T {
+            static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable values can be read as bytes");
+            auto value = T{};
+            std::memcpy(&value, take(sizeof(T)), sizeof(T));
+            return value;
+        }
+
+        template<typename T>
+        auto read_span() -> std::span<const T> {
+            static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable values can be read as bytes");
+            const auto size = static_cast<std::size_t>(read<std::uint64_t>());
+            if (size > bytes_.size() / sizeof(T)) {
+                throw std::runtime_error("Truncated cache entry");
+            }
+            return {reinterpret_cast<const T*>(take(size * sizeof(T))), size};  // NOLINT: the writer aligned it
+        }
+
+        auto read_string() -> std::string_view {
+            const auto chars = read_span<char>();
+            return {chars.data(), chars.size()};
+        }
+
+    private:
+        static constexpr auto ALIGNMENT = std::size_t{8};
+
+        auto take(std::size_t size) -> const std::byte* {
+            const auto padded = (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+            if (padded > bytes_.size()) {
+                throw std::runtime_error("Truncated cache entry");
+            }
+            const auto* const data = bytes_.data();
+            bytes_                 = bytes_.subspan(padded);
+            return data;
+        }
+
+    private:
+        std::span<const std::byte> bytes_;
+    };
+
+    // A directory of entries, one file per key and input content.
+    class Store {
+    public:
+        // the directory is created if it doesn't exist yet
+        explicit Store(std::filesystem::path directory);
+
+        // Loads the model of `input` saved under `key` or parses it and saves it for the next time.
+        //   parse: (std::string_view) -> Model
+        //   save:  (const Model&, Writer&) -> void
+        //   load:  (Reader&) -> Model, must copy what it keeps: the entry is unmapped afterwards
+        template<typename Parse, typename Save, typename Load>
+        auto load_or_parse(
+            std::string_view key, std::uint32_t schema, std::string_view input, Parse parse, Save save, Load load
+        ) const -> decltype(parse(input)) {
+            const auto hash = content_hash(input);
+            if (const auto entry = open(key, schema, hash)) {
+                auto reader = Reader{payload(*entry)};
+                return load(reader);
+            }
+
+            auto model  = parse(input);
+            auto writer = Writer{};
+            save(model, writer);
+            store(key, schema, hash, writer.bytes());
+            return model;
+        }
+
+        [[nodiscard]] auto directory() const -> const std::filesystem::path& {
+            return directory_;
+        }
+
+    private:
+        [[nodiscard]] auto path(std::string_view key, std::uint64_t hash) const -> std::filesystem::path;
+
+        // the entry if it exists and its header matches, nothing otherwise
+        [[nodiscard]] auto open(std::string_view key, std::uint32_t schema, std::uint64_t hash) const
+            -> std::optional<io::MappedFile>;
+        [[nodiscard]] static auto payload(const io::MappedFile& entry) -> std::span<const std::byte>;
+
+        // Writes a temporary file and renames it, so a concurrent reader never sees half an entry. A failure is
+        // reported on stderr and leaves the input uncached.
+        auto store(std::string_view key, std::uint32_t schema, std::uint64_t hash, std::span<const std::byte> payload) const
+            -> void;
+
+    private:
+        std::filesystem::path directory_;
+    };
+}  // namespace core::cache
+
+#endif  // CORE_CACHE_HXX
@@ -0,0 +1,50 @@
+#ifndef CORE_COORDINATE_HXX
+#define CORE_COORDINATE_HXX
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+
+namespace core {
+    struct Coordinate {
+        std::int64_t row = 0;
+        std::int64_t col = 0;
+
+        auto operator<=>(const Coordinate& other) const = default;
+
+        [[nodiscard]] constexpr auto operator+(const Coordinate& other) const -> Coordinate {
+            return Coordinate{
+                .row = row + other.row,
+                .col = col + other.col,
+            };
+        }
+
+        [[nodiscard]] constexpr auto operator-(const Coordinate& other) const -> Coordinate {
+            return Coordinate{
+                .row = row - other.row,
+                .col = col - other.col,
+            };
+        }
+
+        [[nodiscard]] constexpr auto operator*(std::int64_t scalar) const -> Coordinate {
+            return Coordinate{
+                .row = row * scalar,
+                .col = col * scalar,
+            };
+        }
+    };
+}  // namespace core
+
+template<>
+struct std::hash<core::Coordinate> {
+    auto operator()(const core::Coordinate& coordinate) const noexcept -> std::size_t {
+        const auto row_hash = std::hash<std::int64_t>{}(coordinate.row);
+        const auto col_hash = std::hash<std::int64_t>{}(coordinate.col);
+        return row_hash ^ (col_hash << 1);
+    }
+};
+
+
+#endif  // CORE_COORDINATE_HXX
@@ -0,0 +1,53 @@
+#include <core/csr-graph.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+
+namespace core {
+    namespace {
+        // Counting sort of the edges by `key`, stable so every node keeps its edges in input order.
+        template<typename Key, typename Value>
+        auto bucket(std::size_t nodes, std::span<const CsrGraph::Edge> edges, Key key, Value value,
+                    std::vector<std::uint32_t>& offsets, std::vector<CsrGraph::Node>& entries) -> void {
+            offsets.assign(nodes + 1, 0);
+            for (const auto& edge : edges) {
+                offsets[key(edge) + 1]++;
+            }
+            for (auto node = 0ul; node != nodes; node++) {
+                offsets[node + 1] += offsets[node];
+            }
+
+            entries.resize(edges.size());
+            auto next = std::vector<std::uint32_t>(offsets.begin(), offsets.end() - 1);
+            for (const auto& edge : edges) {
+                entries[next[key(edge)]++] = value(edge);
+            }
+        }
+    }  // namespace
+
+
+    CsrGraph::CsrGraph(std::size_t nodes, std::span<const Edge> edges, bool with_reverse) {
+        if (edges.size() > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("CsrGraph: too many edges");
+        }
+        for (const auto& edge : edges) {
+            if (edge.from >= nodes || edge.to >= nodes) {
+                throw std::out_of_range(std::format("CsrGraph: edge {} -> {} past {} nodes", edge.from, edge.to, nodes));
+            }
+        }
+
+        const auto from = [](const Edge& edge) { return edge.from; };
+        const auto to   = [](const Edge& edge) { return edge.to; };
+
+        bucket(nodes, edges, from, to, offsets_, targets_);
+        if (with_reverse) {
+            bucket(nodes, edges, to, from, reverse_offsets_, sources_);
+        }
+    }
+}  // namespace core
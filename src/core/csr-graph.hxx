@@ -0,0 +1,66 @@
+#ifndef CORE_CSR_GRAPH_HXX
+#define CORE_CSR_GRAPH_HXX
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+namespace core {
+    // Directed graph in compressed sparse row form: the targets of every node sit next to each other in one array
+    // and `offsets` tells where each node's run starts. Nodes are dense ids (e.g. from `Interner`).
+    //
+    // Built once from an edge list; the edges of a node keep the order they were listed in. With `with_reverse`
+    // the sources of every node are laid out the same way, so fan-in lookups don't scan the whole graph.
+    class CsrGraph {
+    public:
+        using Node = std::uint32_t;
+
+        struct Edge {
+            Node from = 0;
+            Node to   = 0;
+        };
+
+    public:
+        CsrGraph() = default;
+        CsrGraph(std::size_t nodes, std::span<const Edge> edges, bool with_reverse = false);
+
+        [[nodiscard]] auto node_count() const -> std::size_t {
+            return offsets_.empty() ? 0 : offsets_.size() - 1;
+        }
+
+        [[nodiscard]] auto edge_count() const -> std::size_t {
+            return targets_.size();
+        }
+
+        [[nodiscard]] auto has_reverse() const -> bool {
+            return not reverse_offsets_.empty();
+        }
+
+        [[nodiscard]] auto successors(Node node) const -> std::span<const Node> {
+            return {targets_.data() + offsets_[node], targets_.data() + offsets_[node + 1]};
+        }
+
+        // only available when built `with_reverse`
+        [[nodiscard]] auto predecessors(Node node) const -> std::span<const Node> {
+            return {sources_.data() + reverse_offsets_[node], sources_.data() + reverse_offsets_[node + 1]};
+        }
+
+        [[nodiscard]] auto out_degree(Node node) const -> std::size_t {
+            return offsets_[node + 1] - offsets_[node];
+        }
+
+        [[nodiscard]] auto in_degree(Node node) const -> std::size_t {
+            return reverse_offsets_[node + 1] - reverse_offsets_[node];
+        }
+
+    private:
+        std::vector<std::uint32_t> offsets_;          // node_count + 1 entries
+        std::vector<Node>          targets_;
+        std::vector<std::uint32_t> reverse_offsets_;  // empty without reverse edges
+        std::vector<Node>          sources_;
+    };
+}  // namespace core
+
+#endif  // CORE_CSR_GRAPH_HXX
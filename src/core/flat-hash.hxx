@@ -0,0 +1,477 @@
+#ifndef CORE_FLAT_HASH_HXX
+#define CORE_FLAT_HASH_HXX
+
+#include <core/hash.hxx>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define CORE_FLAT_HASH_SSE2 1
+#endif
+
+
+namespace core::detail {
+    // Every slot has a control byte: `EMPTY` or the low 7 bits of the hash of the stored key.
+    using Control = std::int8_t;
+
+    constexpr auto EMPTY       = Control{-128};
+    constexpr auto GROUP_WIDTH = std::size_t{16};
+
+    // Control bytes of `GROUP_WIDTH` consecutive slots, tested all at once.
+    class Group {
+    public:
+        explicit Group(const Control* controls)
+            : controls_{controls} {}
+
+        // bit `i` is set if the `i`-th control byte equals to `tag`
+        [[nodiscard]] auto match(Control tag) const -> std::uint32_t {
+#ifdef CORE_FLAT_HASH_SSE2
+            const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(controls_));  // NOLINT
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(tag))));
+#else
+            auto mask = std::uint32_t{0};
+            for (auto i = 0ul; i != GROUP_WIDTH; i++) {
+                mask |= static_cast<std::uint32_t>(controls_[i] == tag) << i;
+            }
+            return mask;
+#endif
+        }
+
+        [[nodiscard]] auto match_empty() const -> std::uint32_t {
+#ifdef CORE_FLAT_HASH_SSE2
+            // `EMPTY` is the only control byte with the sign bit set
+            const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(controls_));  // NOLINT
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(chunk));
+#else
+            return match(EMPTY);
+#endif
+        }
+
+    private:
+        const Control* controls_ = nullptr;
+    };
+
+    // Open addressing table with linear probing that scans a whole group of control bytes per step.
+    //
+    // The first `GROUP_WIDTH` control bytes are mirrored past the end, so a group can be loaded at any slot
+    // without wrapping. Erase shifts the following entries back instead of leaving tombstones, so lookups
+    // never slow down after many erasures. Any insert or erase invalidates iterators and references.
+    template<typename Policy, typename Hash, typename KeyEqual>
+    class FlatHashTable {
+    public:
+        using key_type   = typename Policy::key_type;
+        using value_type = typename Policy::slot_type;
+        using size_type  = std::size_t;
+        using hasher     = Hash;
+        using key_equal  = KeyEqual;
+
+        template<bool IsConst>
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using iterator_concept  = std::forward_iterator_tag;
+            using value_type        = FlatHashTable::value_type;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = std::conditional_t<IsConst, const value_type*, value_type*>;
+            using reference         = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+        public:
+            Iterator() = default;
+
+            Iterator(const FlatHashTable* table, size_type index)
+                : table_{table}
+                , index_{index} {
+                skip_empty();
+            }
+
+            // NOLINTNEXTLINE(google-explicit-constructor): iterator converts to const_iterator
+            operator Iterator<true>() const {
+                return {table_, index_};
+            }
+
+            auto operator*() const -> reference {
+                return table_->slots_[index_];
+            }
+
+            auto operator->() const -> pointer {
+                return &table_->slots_[index_];
+            }
+
+            auto operator++() -> Iterator& {
+                index_++;
+                skip_empty();
+                return *this;
+            }
+
+            auto operator++(int) -> Iterator {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            auto operator==(const Iterator& other) const -> bool {
+                return index_ == other.index_;
+            }
+
+        private:
+            void skip_empty() {
+                while (index_ < table_->capacity_ && table_->controls_[index_] == EMPTY) {
+                    index_++;
+                }
+            }
+
+        private:
+            friend class FlatHashTable;
+
+            const FlatHashTable* table_ = nullptr;
+            size_type            index_ = 0;
+        };
+
+        using iterator       = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+    public:
+        FlatHashTable() = default;
+
+        FlatHashTable(const FlatHashTable& other) {
+            reserve(other.size_);
+            for (const auto& slot : other) {
+                insert_unique(Policy::key(slot), slot);
+            }
+        }
+
+        FlatHashTable(FlatHashTable&& other) noexcept {
+            swap(other);
+        }
+
+        auto operator=(const FlatHashTable& other) -> FlatHashTable& {
+            if (this != &other) {
+                auto copy = other;
+                swap(copy);
+            }
+            return *this;
+        }
+
+        auto operator=(FlatHashTable&& other) noexcept -> FlatHashTable& {
+            auto moved = std::move(other);
+            swap(moved);
+            return *this;
+        }
+
+        ~FlatHashTable() {
+            release();
+        }
+
+        void swap(FlatHashTable& other) noexcept {
+            std::swap(controls_, other.controls_);
+            std::swap(slots_, other.slots_);
+            std::swap(capacity_, other.capacity_);
+            std::swap(size_, other.size_);
+        }
+
+        [[nodiscard]] auto begin() -> iterator {
+            return {this, 0};
+        }
+
+        [[nodiscard]] auto end() -> iterator {
+            return {this, capacity_};
+        }
+
+        [[nodiscard]] auto begin() const -> const_iterator {
+            return {this, 0};
+        }
+
+        [[nodiscard]] auto end() const -> const_iterator {
+            return {this, capacity_};
+        }
+
+        [[nodiscard]] auto size() const -> size_type {
+            return size_;
+        }
+
+        [[nodiscard]] auto empty() const -> bool {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] auto capacity() const -> size_type {
+            return capacity_;
+        }
+
+        // makes room for `count` entries without rehashing
+        void reserve(size_type count) {
+            if (count > max_load(capacity_)) {
+                rehash(std::max(GROUP_WIDTH, std::bit_ceil(count + count / 7 + 1)));
+            }
+        }
+
+        // drops all entries but keeps the memory
+        void clear() {
+            for (auto index = 0ul; index != capacity_; index++) {
+                if (controls_[index] != EMPTY) {
+                    std::destroy_at(slots_ + index);
+                }
+            }
+            std::ranges::fill(controls_, EMPTY);
+            size_ = 0;
+        }
+
+        [[nodiscard]] auto find(const key_type& key) -> iterator {
+            return {this, find_index(key, Hash{}(key))};
+        }
+
+        [[nodiscard]] auto find(const key_type& key) const -> const_iterator {
+            return {this, find_index(key, Hash{}(key))};
+        }
+
+        [[nodiscard]] auto contains(const key_type& key) const -> bool {
+            return find_index(key, Hash{}(key)) != capacity_;
+        }
+
+        [[nodiscard]] auto count(const key_type& key) const -> size_type {
+            return contains(key) ? 1 : 0;
+        }
+
+        auto erase(const key_type& key) -> size_type {
+            const auto index = find_index(key, Hash{}(key));
+            if (index == capacity_) {
+                return 0;
+            }
+            erase_at(index);
+            return 1;
+        }
+
+        void erase(const_iterator position) {
+            erase_at(position.index_);
+        }
+
+    protected:
+        // inserts a slot built from `args` unless `key` is already present
+        template<typename... Args>
+        auto insert_unique(const key_type& key, Args&&... args) -> std::pair<iterator, bool> {
+            const auto hash  = Hash{}(key);
+            const auto found = find_index(key, hash);
+            if (found != capacity_) {
+                return {iterator{this, found}, false};
+            }
+
+            reserve(size_ + 1);
+            const auto index = find_empty(hash);
+            std::construct_at(slots_ + index, std::forward<Args>(args)...);
+            set_control(index, tag(hash));
+            size_++;
+            return {iterator{this, index}, true};
+        }
+
+    private:
+        [[nodiscard]] static auto max_load(size_type capacity) -> size_type {
+            return capacity - capacity / 8;
+        }
+
+        [[nodiscard]] static auto tag(size_type hash) -> Control {
+            return static_cast<Control>(hash & 0x7f);
+        }
+
+        [[nodiscard]] auto home(size_type hash) const -> size_type {
+            return (hash >> 7) & (capacity_ - 1);
+        }
+
+        [[nodiscard]] auto find_index(const key_type& key, size_type hash) const -> size_type {
+            if (capacity_ == 0) {
+                return capacity_;
+            }
+
+            const auto mask  = capacity_ - 1;
+            const auto token = tag(hash);
+            for (auto position = home(hash);; position = (position + GROUP_WIDTH) & mask) {
+                const auto group = Group{controls_.data() + position};
+                for (auto matches = group.match(token); matches != 0; matches &= matches - 1) {
+                    const auto index = (position + std::countr_zero(matches)) & mask;
+                    if (KeyEqual{}(Policy::key(slots_[index]), key)) {
+                        return index;
+                    }
+                }
+
+                // the probe sequence of a key never crosses an empty slot
+                if (group.match_empty() != 0) {
+                    return capacity_;
+                }
+            }
+        }
+
+        [[nodiscard]] auto find_empty(size_type hash) const -> size_type {
+            const auto mask = capacity_ - 1;
+            for (auto position = home(hash);; position = (position + GROUP_WIDTH) & mask) {
+                if (const auto empty = Group{controls_.data() + position}.match_empty(); empty != 0) {
+                    return (position + std::countr_zero(empty)) & mask;
+                }
+            }
+        }
+
+        void set_control(size_type index, Control control) {
+            controls_[index] = control;
+            if (index < GROUP_WIDTH) {
+                controls_[capacity_ + index] = control;
+            }
+        }
+
+        void erase_at(size_type index) {
+            const auto mask = capacity_ - 1;
+
+            // backward shift: pull every following entry of the probe run into the hole if it may live there
+            std::destroy_at(slots_ + index);
+            auto hole = index;
+            for (auto next = (hole + 1) & mask; controls_[next] != EMPTY; next = (next + 1) & mask) {
+                const auto desired = home(Hash{}(Policy::key(slots_[next])));
+                if (((next - desired) & mask) >= ((next - hole) & mask)) {
+                    std::construct_at(slots_ + hole, std::move(slots_[next]));
+                    std::destroy_at(slots_ + next);
+                    set_control(hole, controls_[next]);
+                    hole = next;
+                }
+            }
+
+            set_control(hole, EMPTY);
+            size_--;
+        }
+
+        void rehash(size_type capacity) {
+            auto old_controls = std::exchange(controls_, std::vector<Control>(capacity + GROUP_WIDTH, EMPTY));
+            auto old_slots    = std::exchange(slots_, std::allocator<value_type>{}.allocate(capacity));
+            auto old_capacity = std::exchange(capacity_, capacity);
+
+            for (auto index = 0ul; index != old_capacity; index++) {
+                if (old_controls[index] != EMPTY) {
+                    const auto slot = find_empty(Hash{}(Policy::key(old_slots[index])));
+                    std::construct_at(slots_ + slot, std::move(old_slots[index]));
+                    std::destroy_at(old_slots + index);
+                    set_control(slot, old_controls[index]);
+                }
+            }
+
+            if (old_slots != nullptr) {
+                std::allocator<value_type>{}.deallocate(old_slots, old_capacity);
+            }
+        }
+
+        void release() {
+            if (slots_ != nullptr) {
+                clear();
+                std::allocator<value_type>{}.deallocate(slots_, capacity_);
+            }
+            controls_.clear();
+            slots_    = nullptr;
+            capacity_ = 0;
+        }
+
+    private:
+        std::vector<Control> controls_;
+        value_type*          slots_    = nullptr;
+        size_type            capacity_ = 0;
+        size_type            size_     = 0;
+    };
+
+    template<typename Key>
+    struct SetPolicy {
+        using key_type  = Key;
+        using slot_type = Key;
+
+        static auto key(const slot_type& slot) -> const key_type& {
+            return slot;
+        }
+    };
+
+    template<typename Key, typename Value>
+    struct MapPolicy {
+        using key_type  = Key;
+        using slot_type = std::pair<const Key, Value>;
+
+        static auto key(const slot_type& slot) -> const key_type& {
+            return slot.first;
+        }
+    };
+}  // namespace core::detail
+
+
+namespace core {
+    // Drop-in replacement for `std::unordered_set` when keys are small: entries live in one flat buffer.
+    template<typename Key, typename Hash = hash::Hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class FlatHashSet : public detail::FlatHashTable<detail::SetPolicy<Key>, Hash, KeyEqual> {
+        using Base = detail::FlatHashTable<detail::SetPolicy<Key>, Hash, KeyEqual>;
+
+    public:
+        using typename Base::iterator;
+
+        auto insert(const Key& key) -> std::pair<iterator, bool> {
+            return this->insert_unique(key, key);
+        }
+
+        template<typename... Args>
+        auto emplace(Args&&... args) -> std::pair<iterator, bool> {
+            const auto key = Key{std::forward<Args>(args)...};
+            return this->insert_unique(key, key);
+        }
+    };
+
+    // Drop-in replacement for `std::unordered_map` when entries are small: they live in one flat buffer.
+    template<typename Key, typename Value, typename Hash = hash::Hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class FlatHashMap : public detail::FlatHashTable<detail::MapPolicy<Key, Value>, Hash, KeyEqual> {
+        using Base = detail::FlatHashTable<detail::MapPolicy<Key, Value>, Hash, KeyEqual>;
+
+    public:
+        using typename Base::iterator;
+        using mapped_type = Value;
+
+        template<typename... Args>
+        auto try_emplace(const Key& key, Args&&... args) -> std::pair<iterator, bool> {
+            return this->insert_unique(
+                key,
+                std::piecewise_construct,
+                std::forward_as_tuple(key),
+                std::forward_as_tuple(std::forward<Args>(args)...)
+            );
+        }
+
+        template<typename... Args>
+        auto emplace(const Key& key, Args&&... args) -> std::pair<iterator, bool> {
+            return try_emplace(key, std::forward<Args>(args)...);
+        }
+
+        auto insert(const typename Base::value_type& entry) -> std::pair<iterator, bool> {
+            return this->insert_unique(entry.first, entry);
+        }
+
+        auto operator[](const Key& key) -> Value& {
+            return try_emplace(key).first->second;
+        }
+
+        [[nodiscard]] auto at(const Key& key) -> Value& {
+            const auto it = this->find(key);
+            if (it == this->end()) {
+                throw std::out_of_range("FlatHashMap::at: key not found");
+            }
+            return it->second;
+        }
+
+        [[nodiscard]] auto at(const Key& key) const -> const Value& {
+            const auto it = this->find(key);
+            if (it == this->end()) {
+                throw std::out_of_range("FlatHashMap::at: key not found");
+            }
+            return it->second;
+        }
+    };
+}  // namespace core
+
+
+#endif  // CORE_FLAT_HASH_HXX
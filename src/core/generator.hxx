@@ -0,0 +1,131 @@
+#ifndef CORE_GENERATOR_HXX
+#define CORE_GENERATOR_HXX
+
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <utility>
+
+
+namespace core {
+    // Lazily produced sequence written as a coroutine that `co_yield`s its values, a stand-in for the C++23
+    // std::generator that the supported standard libraries don't ship yet.
+    //
+    // Single pass: `begin` starts the coroutine and every increment resumes it up to the next value. An exception
+    // thrown by the coroutine comes out of the increment (or `begin`) that resumed it.
+    template<typename T>
+    class Generator {
+    public:
+        struct promise_type {
+            std::optional<T>   value;
+            std::exception_ptr error;
+
+            auto get_return_object() -> Generator {
+                return Generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            auto initial_suspend() noexcept -> std::suspend_always {
+                return {};
+            }
+
+            auto final_suspend() noexcept -> std::suspend_always {
+                return {};
+            }
+
+            template<std::convertible_to<T> From>
+            auto yield_value(From&& from) -> std::suspend_always {
+                value.emplace(std::forward<From>(from));
+                return {};
+            }
+
+            auto return_void() -> void {}
+
+            auto unhandled_exception() -> void {
+                error = std::current_exception();
+            }
+        };
+
+        class Iterator {
+        public:
+            using value_type      = T;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() = default;
+
+            explicit Iterator(std::coroutine_handle<promise_type> handle)
+                : handle_{handle} {}
+
+            auto operator*() const -> T& {
+                return *handle_.promise().value;
+            }
+
+            auto operator++() -> Iterator& {
+                resume(handle_);
+                return *this;
+            }
+
+            auto operator++(int) -> void {
+                ++*this;
+            }
+
+            friend auto operator==(const Iterator& it, std::default_sentinel_t /*end*/) -> bool {
+                return it.handle_.done();
+            }
+
+        private:
+            std::coroutine_handle<promise_type> handle_;
+        };
+
+    public:
+        Generator(const Generator&) = delete;
+        Generator(Generator&& other) noexcept
+            : handle_{std::exchange(other.handle_, nullptr)} {}
+
+        auto operator=(const Generator&) -> Generator& = delete;
+        auto operator=(Generator&& other) noexcept -> Generator& {
+            if (this != &other) {
+                if (handle_) {
+                    handle_.destroy();
+                }
+                handle_ = std::exchange(other.handle_, nullptr);
+            }
+            return *this;
+        }
+
+        // a coroutine suspended halfway is destroyed with everything it holds
+        ~Generator() {
+            if (handle_) {
+                handle_.destroy();
+            }
+        }
+
+        auto begin() -> Iterator {
+            resume(handle_);
+            return Iterator{handle_};
+        }
+
+        auto end() -> std::default_sentinel_t {
+            return std::default_sentinel;
+        }
+
+    private:
+        explicit Generator(std::coroutine_handle<promise_type> handle)
+            : handle_{handle} {}
+
+        static auto resume(std::coroutine_handle<promise_type> handle) -> void {
+            handle.promise().value.reset();
+            handle.resume();
+            if (auto error = std::exchange(handle.promise().error, nullptr)) {
+                std::rethrow_exception(error);
+            }
+        }
+
+    private:
+        std::coroutine_handle<promise_type> handle_;
+    };
+}  // namespace core
+
+#endif  // CORE_GENERATOR_HXX
@@ -0,0 +1,286 @@
+#ifndef CORE_GRID_HXX
+#define CORE_GRID_HXX
+
+#include <core/coordinate.hxx>
+#include <core/profile.hxx>
+#include <core/scan.hxx>
+#include <core/strings.hxx>
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+
+namespace core {
+    // Random access iterator over cells that are `stride` elements apart (e.g. a column of a row-major buffer).
+    template<typename T>
+    class StridedIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept  = std::random_access_iterator_tag;
+        using value_type        = std::remove_cv_t<T>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T*;
+        using reference         = T&;
+
+    public:
+        StridedIterator() = default;
+
+        StridedIterator(T* first, difference_type stride, difference_type position)
+            : first_{first}
+            , stride_{stride}
+            , position_{position} {}
+
+        auto operator*() const -> T& {
+            return first_[position_ * stride_];
+        }
+
+        auto operator->() const -> T* {
+            return &**this;
+        }
+
+        auto operator[](difference_type offset) const -> T& {
+            return first_[(position_ + offset) * stride_];
+        }
+
+        auto operator++() -> StridedIterator& {
+            ++position_;
+            return *this;
+        }
+
+        auto operator++(int) -> StridedIterator {
+            auto copy = *this;
+            ++position_;
+            return copy;
+        }
+
+        auto operator--() -> StridedIterator& {
+            --position_;
+            return *this;
+        }
+
+        auto operator--(int) -> StridedIterator {
+            auto copy = *this;
+            --position_;
+            return copy;
+        }
+
+        auto operator+=(difference_type offset) -> StridedIterator& {
+            position_ += offset;
+            return *this;
+        }
+
+        auto operator-=(difference_type offset) -> StridedIterator& {
+            position_ -= offset;
+            return *this;
+        }
+
+        friend auto operator+(StridedIterator it, difference_type offset) -> StridedIterator {
+            return it += offset;
+        }
+
+        friend auto operator+(difference_type offset, StridedIterator it) -> StridedIterator {
+            return it += offset;
+        }
+
+        friend auto operator-(StridedIterator it, difference_type offset) -> StridedIterator {
+            return it -= offset;
+        }
+
+        friend auto operator-(const StridedIterator& lhs, const StridedIterator& rhs) -> difference_type {
+            return lhs.position_ - rhs.position_;
+        }
+
+        friend auto operator==(const StridedIterator& lhs, const StridedIterator& rhs) -> bool {
+            return lhs.position_ == rhs.position_;
+        }
+
+        friend auto operator<=>(const StridedIterator& lhs, const StridedIterator& rhs) {
+            return lhs.position_ <=> rhs.position_;
+        }
+
+    private:
+        T*              first_    = nullptr;
+        difference_type stride_   = 1;
+        difference_type position_ = 0;
+    };
+
+    // Row-major grid stored in one flat buffer.
+    //
+    // The grid can be surrounded by `padding` rows and columns of `border` cells, so a walk that stops on a
+    // sentinel never needs bounds checks. Cells are addressed either by `Coordinate` (the inner area starts at
+    // {0, 0}, border cells have negative or past-the-end coordinates) or by linear `Index` into the buffer.
+    template<typename T>
+    class Grid2D {
+        static_assert(!std::is_same_v<T, bool>, "std::vector<bool> isn't addressable, use std::uint8_t instead");
+
+    public:
+        using Index = std::int64_t;
+
+        // direction indexes used by `neighbours`
+        enum Direction : std::uint8_t {
+            NORTH,
+            SOUTH,
+            WEST,
+            EAST,
+        };
+
+    public:
+        Grid2D() = default;
+
+        Grid2D(Index rows, Index cols, Index padding = 0, T fill = {}, T border = {})
+            : rows_{rows}
+            , cols_{cols}
+            , padding_{padding}
+            , stride_{cols + 2 * padding}
+            , cells_(static_cast<std::size_t>((rows + 2 * padding) * (cols + 2 * padding)), border) {
+            for (auto row = Index{0}; row != rows_; row++) {
+                std::ranges::fill(this->row(row), fill);
+            }
+        }
+
+        // Builds a grid from newline separated rows of equal width, `project` maps every symbol onto a cell.
+        template<typename Project = std::identity>
+        static auto parse(std::string_view text, Index padding = 0, T border = {}, Project project = {}) -> Grid2D {
+            CORE_PROFILE_ZONE("grid/parse");
+
+            text = strings::strip(text, "\n\r");
+            if (text.empty()) {
+                return Grid2D{0, 0, padding, border, border};
+            }
+
+            // rows are measured like they are stored below, without the '\r' of a CRLF line end
+            auto first_row = text.substr(0, std::min(scan::find(text, '\n'), text.size()));
+            if (first_row.ends_with('\r')) {
+                first_row.remove_suffix(1);
+            }
+
+            const auto cols = static_cast<Index>(first_row.size());
+            const auto rows = static_cast<Index>(scan::count(text, '\n')) + 1;
+
+            auto grid = Grid2D{rows, cols, padding, border, border};
+            auto row  = Index{0};
+            for (auto line : strings::split_view(text, "\n")) {
+                if (line.ends_with('\r')) {
+                    line.remove_suffix(1);
+                }
+
+                if (std::ssize(line) != cols) {
+                    throw std::runtime_error("Failed to parse grid: rows have different width");
+                }
+
+                std::ranges::transform(line, grid.row(row).begin(), project);
+                row++;
+            }
+
+            return grid;
+        }
+
+        [[nodiscard]] auto rows() const -> Index {
+            return rows_;
+        }
+
+        [[nodiscard]] auto cols() const -> Index {
+            return cols_;
+        }
+
+        [[nodiscard]] auto padding() const -> Index {
+            return padding_;
+        }
+
+        [[nodiscard]] auto stride() const -> Index {
+            return stride_;
+        }
+
+        [[nodiscard]] auto contains(Coordinate position) const -> bool {
+            return position.row >= 0 && position.col >= 0 && position.row < rows_ && position.col < cols_;
+        }
+
+        [[nodiscard]] auto index(Coordinate position) const -> Index {
+            return (position.row + padding_) * stride_ + (position.col + padding_);
+        }
+
+        [[nodiscard]] auto coordinate(Index index) const -> Coordinate {
+            return {
+                .row = (index / stride_) - padding_,
+                .col = (index % stride_) - padding_,
+            };
+        }
+
+        // linear distance of one step into `direction`
+        [[nodiscard]] auto offset(Coordinate direction) const -> Index {
+            return direction.row * stride_ + direction.col;
+        }
+
+        // indexes of the orthogonal neighbours, ordered as `Direction`
+        [[nodiscard]] auto neighbours(Index index) const -> std::array<Index, 4> {
+            return {index - stride_, index + stride_, index - 1, index + 1};
+        }
+
+        auto operator[](Index index) -> T& {
+            return cells_[static_cast<std::size_t>(index)];
+        }
+
+        auto operator[](Index index) const -> const T& {
+            return cells_[static_cast<std::size_t>(index)];
+        }
+
+        auto operator[](Coordinate position) -> T& {
+            return (*this)[index(position)];
+        }
+
+        auto operator[](Coordinate position) const -> const T& {
+            return (*this)[index(position)];
+        }
+
+        [[nodiscard]] auto row(Index row) -> std::span<T> {
+            return {cells_.data() + index({row, 0}), static_cast<std::size_t>(cols_)};
+        }
+
+        [[nodiscard]] auto row(Index row) const -> std::span<const T> {
+            return {cells_.data() + index({row, 0}), static_cast<std::size_t>(cols_)};
+        }
+
+        // random access view over the cells of a column (a `stride()` apart in the buffer)
+        [[nodiscard]] auto column(Index col) -> std::ranges::subrange<StridedIterator<T>> {
+            auto* const first = cells_.data() + index({0, col});
+            return {StridedIterator<T>{first, stride_, 0}, StridedIterator<T>{first, stride_, rows_}};
+        }
+
+        [[nodiscard]] auto column(Index col) const -> std::ranges::subrange<StridedIterator<const T>> {
+            const auto* const first = cells_.data() + index({0, col});
+            return {StridedIterator<const T>{first, stride_, 0}, StridedIterator<const T>{first, stride_, rows_}};
+        }
+
+        // the whole buffer, border cells included
+        [[nodiscard]] auto cells() -> std::span<T> {
+            return cells_;
+        }
+
+        [[nodiscard]] auto cells() const -> std::span<const T> {
+            return cells_;
+        }
+
+        auto operator==(const Grid2D& other) const -> bool = default;
+
+    private:
+        Index          rows_    = 0;
+        Index          cols_    = 0;
+        Index          padding_ = 0;
+        Index          stride_  = 0;
+        std::vector<T> cells_;
+    };
+}  // namespace core
+
+
+#endif  // CORE_GRID_HXX
@@ -0,0 +1,51 @@
+#ifndef CORE_HASH_HXX
+#define CORE_HASH_HXX
+
+#include <core/coordinate.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+
+namespace core::hash {
+    // Finalizer of splitmix64: every input bit affects every output bit, so low bits are usable as a bucket index.
+    [[nodiscard]] constexpr auto mix(std::uint64_t value) -> std::uint64_t {
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ull;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebull;
+        value ^= value >> 31;
+        return value;
+    }
+
+    [[nodiscard]] constexpr auto combine(std::uint64_t seed, std::uint64_t value) -> std::uint64_t {
+        return mix(seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2)));
+    }
+
+    // Packs both axes into one word, it's injective as long as every axis fits into 32 bits.
+    [[nodiscard]] constexpr auto pack(const Coordinate& coordinate) -> std::uint64_t {
+        const auto row = static_cast<std::uint32_t>(coordinate.row);
+        const auto col = static_cast<std::uint32_t>(coordinate.col);
+        return (static_cast<std::uint64_t>(row) << 32) | col;
+    }
+
+    // Default hasher of the flat containers: `std::hash` is the identity for integers in libstdc++,
+    // so its result is mixed before use.
+    template<typename Key>
+    struct Hash {
+        auto operator()(const Key& key) const noexcept -> std::size_t {
+            return static_cast<std::size_t>(mix(static_cast<std::uint64_t>(std::hash<Key>{}(key))));
+        }
+    };
+
+    template<>
+    struct Hash<Coordinate> {
+        auto operator()(const Coordinate& coordinate) const noexcept -> std::size_t {
+            return static_cast<std::size_t>(mix(pack(coordinate)));
+        }
+    };
+}  // namespace core::hash
+
+
+#endif  // CORE_HASH_HXX
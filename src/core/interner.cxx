@@ -0,0 +1,45 @@
+#include <core/interner.hxx>
+
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+
+namespace core {
+    Interner::Interner(const Interner& other)
+        : names_{other.names_} {
+        for (auto id = Id{0}; id != names_.size(); id++) {
+            ids_.try_emplace(names_[id], id);
+        }
+    }
+
+    auto Interner::operator=(const Interner& other) -> Interner& {
+        if (this != &other) {
+            auto copy = other;
+            *this     = std::move(copy);
+        }
+        return *this;
+    }
+
+    auto Interner::intern(std::string_view label) -> Id {
+        if (const auto it = ids_.find(label); it != ids_.end()) {
+            return it->second;
+        }
+
+        if (names_.size() == NONE) {
+            throw std::length_error("Interner: out of ids");
+        }
+
+        const auto id = static_cast<Id>(names_.size());
+        ids_.try_emplace(names_.emplace_back(label), id);
+        return id;
+    }
+
+    auto Interner::find(std::string_view label) const -> std::optional<Id> {
+        if (const auto it = ids_.find(label); it != ids_.end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+}  // namespace core
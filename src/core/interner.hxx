@@ -0,0 +1,58 @@
+#ifndef CORE_INTERNER_HXX
+#define CORE_INTERNER_HXX
+
+#include <core/flat-hash.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+
+
+namespace core {
+    // Maps labels to dense ids in order of first appearance, so a solver can hash every label once while parsing
+    // and then index plain vectors by id.
+    class Interner {
+    public:
+        using Id = std::uint32_t;
+
+        // never returned by `intern`, handy as "no label"
+        static constexpr auto NONE = std::numeric_limits<Id>::max();
+
+    public:
+        Interner() = default;
+
+        // the lookup table points into the names, so a copy builds its own
+        Interner(const Interner& other);
+        Interner(Interner&&) noexcept = default;
+
+        auto operator=(const Interner& other) -> Interner&;
+        auto operator=(Interner&&) noexcept -> Interner& = default;
+
+        ~Interner() = default;
+
+        // id of the label, a new one if it hasn't been seen before
+        auto intern(std::string_view label) -> Id;
+
+        [[nodiscard]] auto find(std::string_view label) const -> std::optional<Id>;
+
+        [[nodiscard]] auto name(Id id) const -> std::string_view {
+            return names_.at(id);
+        }
+
+        // ids are [0, size)
+        [[nodiscard]] auto size() const -> std::size_t {
+            return names_.size();
+        }
+
+    private:
+        // a deque never moves its elements, so the views stay valid while it grows
+        std::deque<std::string>           names_;
+        FlatHashMap<std::string_view, Id> ids_;
+    };
+}  // namespace core
+
+#endif  // CORE_INTERNER_HXX
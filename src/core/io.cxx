@@ -1,11 +1,25 @@
 #include <core/io.hxx>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <format>
 #include <fstream>
 #include <ios>
 #include <istream>
 #include <iterator>
+#include <optional>
 #include <set>
 #include <string>
+#include <string_view>
+#include <utility>
 
 
 namespace core::io {
@@ -39,6 +53,123 @@ namespace core::io {
         return content;
     }
 
+    MappedFile::MappedFile(const std::filesystem::path& path) {
+        const auto descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (descriptor == -1) {
+            throw std::ios::failure{"Failed to open file"};
+        }
+
+        struct stat info {};
+        if (::fstat(descriptor, &info) == -1 || !S_ISREG(info.st_mode)) {
+            ::close(descriptor);
+            throw std::ios::failure{"Failed to map file: not a regular file"};
+        }
+
+        // mmap refuses zero-length mappings, an empty file is just an empty view
+        if (info.st_size == 0) {
+            ::close(descriptor);
+            return;
+        }
+
+        auto* const address = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+        ::close(descriptor);  // the mapping keeps its own reference to the file
+        if (address == MAP_FAILED) {
+            throw std::ios::failure{"Failed to map file content"};
+        }
+
+        ::madvise(address, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+
+        data_ = static_cast<const char*>(address);
+        size_ = static_cast<std::size_t>(info.st_size);
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : data_{std::exchange(other.data_, nullptr)}
+        , size_{std::exchange(other.size_, 0)} {}
+
+    auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile& {
+        if (this != &other) {
+            release();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    MappedFile::~MappedFile() {
+        release();
+    }
+
+    auto MappedFile::release() noexcept -> void {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<char*>(data_), size_);  // NOLINT: munmap takes a non-const pointer
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    LineReader::LineReader(int descriptor, std::size_t chunk_size)
+        : descriptor_{descriptor}
+        , buffer_(std::max(chunk_size, std::size_t{1})) {}
+
+    auto LineReader::next(char delimiter) -> std::optional<std::string_view> {
+        while (true) {
+            const auto* const first = buffer_.data() + scanned_;
+            const auto* const last  = buffer_.data() + end_;
+            if (const auto* const found = std::find(first, last, delimiter); found != last) {
+                const auto start = std::exchange(begin_, static_cast<std::size_t>(found - buffer_.data()) + 1);
+                scanned_         = begin_;
+                return std::string_view{buffer_.data() + start, found};
+            }
+            scanned_ = end_;
+
+            if (not fill()) {
+                if (begin_ == end_) {
+                    return std::nullopt;
+                }
+                const auto start = std::exchange(begin_, end_);
+                return std::string_view{buffer_.data() + start, buffer_.data() + end_};
+            }
+        }
+    }
+
+    auto LineReader::fill() -> bool {
+        if (eof_) {
+            return false;
+        }
+
+        // the unfinished record moves to the front, the buffer only grows for a record longer than itself
+        std::copy(buffer_.begin() + static_cast<std::ptrdiff_t>(begin_), buffer_.begin() + static_cast<std::ptrdiff_t>(end_),
+                  buffer_.begin());
+        end_ -= begin_;
+        scanned_ -= begin_;
+        begin_ = 0;
+        if (end_ == buffer_.size()) {
+            buffer_.resize(buffer_.size() * 2);
+        }
+
+        while (true) {
+            const auto count = ::read(descriptor_, buffer_.data() + end_, buffer_.size() - end_);
+            if (count > 0) {
+                end_ += static_cast<std::size_t>(count);
+                return true;
+            }
+            if (count == 0) {
+                eof_ = true;
+                return false;
+            }
+            if (errno != EINTR) {
+                throw std::ios::failure{std::format("Failed to read input: {}", std::strerror(errno))};
+            }
+        }
+    }
+
+    auto records(LineReader& reader, char delimiter) -> Generator<std::string_view> {
+        while (const auto record = reader.next(delimiter)) {
+            co_yield *record;
+        }
+    }
+
     auto skip(std::istream& stream, std::string_view ignored) -> std::istream& {
         const auto banned = std::set<int>{ignored.begin(), ignored.end()};
         return skip(stream, [&banned](int symbol) -> bool { return banned.contains(symbol); });
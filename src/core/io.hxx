@@ -1,11 +1,17 @@
 #ifndef CORE_IO_HXX
 #define CORE_IO_HXX
 
+#include <core/generator.hxx>
+
 #include <algorithm>
 #include <cstddef>
+#include <filesystem>
 #include <istream>
+#include <optional>
 #include <ranges>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 
@@ -54,6 +60,78 @@ namespace core::io {
         return read_file(path.string(), as_text);
     }
 
+    // Read-only memory mapping of a regular file; the content stays valid while the object is alive.
+    // Use `read_file` for sources that can't be mapped (pipes, character devices, etc.).
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::filesystem::path& path);
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+
+        auto operator=(const MappedFile&) -> MappedFile& = delete;
+        auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+
+        ~MappedFile();
+
+        [[nodiscard]] auto data() const -> const char* {
+            return data_;
+        }
+
+        [[nodiscard]] auto size() const -> std::size_t {
+            return size_;
+        }
+
+        [[nodiscard]] auto empty() const -> bool {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] auto view() const -> std::string_view {
+            return {data_, size_};
+        }
+
+        [[nodiscard]] auto span() const -> std::span<const char> {
+            return {data_, size_};
+        }
+
+    private:
+        auto release() noexcept -> void;
+
+    private:
+        const char* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    // Splits a stream that can't be mapped (stdin, a pipe, a socket) into records while reading it chunk by chunk.
+    // Only the unfinished record is kept between chunks, so memory is bounded by the chunk size and the longest
+    // record, not by the length of the stream. The descriptor is borrowed, not closed.
+    class LineReader {
+    public:
+        static constexpr auto DEFAULT_CHUNK_SIZE = std::size_t{64 * 1024};
+
+    public:
+        explicit LineReader(int descriptor, std::size_t chunk_size = DEFAULT_CHUNK_SIZE);
+
+        // Next record without its delimiter, empty once the stream is exhausted. A last record without
+        // a delimiter is still returned. The view is valid until the following call.
+        auto next(char delimiter = '\n') -> std::optional<std::string_view>;
+
+    private:
+        // false at the end of the stream
+        auto fill() -> bool;
+
+    private:
+        int               descriptor_;
+        std::vector<char> buffer_;
+        std::size_t       begin_   = 0;  // start of the unfinished record
+        std::size_t       scanned_ = 0;  // where the search for a delimiter resumes
+        std::size_t       end_     = 0;
+        bool              eof_     = false;
+    };
+
+    // The records of `reader` as a generator, empty ones included. Each view is valid until the generator is resumed.
+    auto records(LineReader& reader, char delimiter = '\n') -> Generator<std::string_view>;
+
     auto skip(std::istream& stream, std::string_view ignored) -> std::istream&;
 
     template<typename Filter>
@@ -0,0 +1,357 @@
+#include <core/loader.hxx>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+namespace {
+    using core::io::LoadedFile;
+
+    // a single read never asks for more, the kernel caps it around there anyway
+    constexpr auto MAX_READ = std::size_t{1} << 30;
+
+    auto failure(const std::filesystem::path& path, std::string_view action, int error) -> std::exception_ptr {
+        return std::make_exception_ptr(
+            std::ios::failure{std::format("Failed to {} {}: {}", action, path.string(), std::strerror(error))}
+        );
+    }
+
+    // Reads from `offset` to the end of the file, appending to `content`. Returns zero or the errno.
+    auto read_rest(int descriptor, std::string& content, std::size_t offset) -> int {
+        content.resize(std::max(content.size(), offset + 4096));
+        while (true) {
+            if (offset == content.size()) {
+                content.resize(content.size() * 2);
+            }
+
+            const auto count = ::pread(descriptor, content.data() + offset, content.size() - offset, static_cast<off_t>(offset));
+            if (count > 0) {
+                offset += static_cast<std::size_t>(count);
+            } else if (count == 0) {
+                content.resize(offset);
+                return 0;
+            } else if (errno != EINTR) {
+                return errno;
+            }
+        }
+    }
+
+    auto read_now(const std::filesystem::path& path, std::size_t index) -> LoadedFile {
+        auto file = LoadedFile{.index = index};
+
+        const auto descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (descriptor == -1) {
+            file.error = failure(path, "open", errno);
+            return file;
+        }
+
+        if (const auto error = read_rest(descriptor, file.content, 0); error != 0) {
+            file.error = failure(path, "read", error);
+            file.content.clear();
+        }
+        ::close(descriptor);
+        return file;
+    }
+}  // namespace
+
+
+namespace core::io {
+    // The rings shared with the kernel and the reads they carry. Only used with the loader's lock held.
+    struct FileLoader::Ring {
+        struct Read {
+            std::size_t index      = 0;
+            int         descriptor = -1;
+            std::string content;  // sized to the file up front, reads land in place
+            std::size_t done = 0;
+        };
+
+        int           descriptor = -1;
+        void*         sq_ring    = MAP_FAILED;
+        void*         cq_ring    = MAP_FAILED;
+        std::size_t   sq_size    = 0;
+        std::size_t   cq_size    = 0;
+        io_uring_sqe* sqes       = nullptr;
+        std::size_t   sqes_size  = 0;
+
+        unsigned*           sq_tail  = nullptr;
+        unsigned            sq_mask  = 0;
+        unsigned*           sq_array = nullptr;
+        unsigned*           cq_head  = nullptr;
+        unsigned*           cq_tail  = nullptr;
+        unsigned            cq_mask  = 0;
+        const io_uring_cqe* cqes     = nullptr;
+        unsigned            queued   = 0;  // entries written to the submission ring but not submitted yet
+
+        std::vector<std::optional<Read>> reads;  // indexed by the user data of the entries
+        std::vector<std::size_t>         free_reads;
+        std::size_t                      active = 0;
+        std::deque<LoadedFile>           ready;
+
+        Ring() = default;
+
+        Ring(const Ring&) = delete;
+        Ring(Ring&&)      = delete;
+
+        auto operator=(const Ring&) -> Ring& = delete;
+        auto operator=(Ring&&) -> Ring&      = delete;
+
+        ~Ring() {
+            for (const auto& read : reads) {
+                if (read) {
+                    ::close(read->descriptor);
+                }
+            }
+            if (sqes != nullptr) {
+                ::munmap(sqes, sqes_size);
+            }
+            if (cq_ring != MAP_FAILED && cq_ring != sq_ring) {
+                ::munmap(cq_ring, cq_size);
+            }
+            if (sq_ring != MAP_FAILED) {
+                ::munmap(sq_ring, sq_size);
+            }
+            if (descriptor != -1) {
+                ::close(descriptor);
+            }
+        }
+
+        // null if the kernel doesn't let us have one
+        static auto create(std::size_t entries) -> std::unique_ptr<Ring> {
+            auto ring   = std::make_unique<Ring>();
+            auto params = io_uring_params{};
+
+            ring->descriptor = static_cast<int>(::syscall(__NR_io_uring_setup, static_cast<unsigned>(entries), &params));
+            if (ring->descriptor < 0) {
+                ring->descriptor = -1;
+                return nullptr;
+            }
+
+            ring->sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            ring->cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            const auto single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (single_mmap) {
+                ring->sq_size = ring->cq_size = std::max(ring->sq_size, ring->cq_size);
+            }
+
+            constexpr auto PROTECTION = PROT_READ | PROT_WRITE;
+            constexpr auto FLAGS      = MAP_SHARED | MAP_POPULATE;
+            ring->sq_ring = ::mmap(nullptr, ring->sq_size, PROTECTION, FLAGS, ring->descriptor, IORING_OFF_SQ_RING);
+            if (ring->sq_ring == MAP_FAILED) {
+                return nullptr;
+            }
+            ring->cq_ring = single_mmap ? ring->sq_ring
+                                        : ::mmap(nullptr, ring->cq_size, PROTECTION, FLAGS, ring->descriptor, IORING_OFF_CQ_RING);
+            if (ring->cq_ring == MAP_FAILED) {
+                return nullptr;
+            }
+
+            ring->sqes_size  = params.sq_entries * sizeof(io_uring_sqe);
+            auto* const sqes = ::mmap(nullptr, ring->sqes_size, PROTECTION, FLAGS, ring->descriptor, IORING_OFF_SQES);
+            if (sqes == MAP_FAILED) {
+                return nullptr;
+            }
+            ring->sqes = static_cast<io_uring_sqe*>(sqes);
+
+            // NOLINTBEGIN: the offsets describe the layout of the shared memory
+            auto* const sq = static_cast<std::byte*>(ring->sq_ring);
+            auto* const cq = static_cast<std::byte*>(ring->cq_ring);
+            ring->sq_tail  = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+            ring->sq_mask  = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+            ring->sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+            ring->cq_head  = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+            ring->cq_tail  = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+            ring->cq_mask  = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+            ring->cqes     = reinterpret_cast<const io_uring_cqe*>(cq + params.cq_off.cqes);
+            // NOLINTEND
+
+            ring->reads.resize(entries);
+            for (auto slot = entries; slot != 0; slot--) {
+                ring->free_reads.push_back(slot - 1);
+            }
+            return ring;
+        }
+
+        auto queue_read(std::size_t slot) -> void {
+            const auto& read = *reads[slot];
+
+            // only this side writes the tail, the kernel reads it once it's published
+            const auto tail     = *sq_tail;
+            const auto position = tail & sq_mask;
+
+            auto& entry     = sqes[position];
+            entry           = io_uring_sqe{};
+            entry.opcode    = IORING_OP_READ;
+            entry.fd        = read.descriptor;
+            entry.addr      = reinterpret_cast<std::uint64_t>(read.content.data() + read.done);  // NOLINT
+            entry.len       = static_cast<std::uint32_t>(std::min(read.content.size() - read.done, MAX_READ));
+            entry.off       = read.done;
+            entry.user_data = slot;
+
+            sq_array[position] = position;
+            std::atomic_ref{*sq_tail}.store(tail + 1, std::memory_order_release);
+            queued++;
+        }
+
+        // submits what was queued and waits for `wait` completions
+        auto enter(unsigned wait) -> void {
+            const auto flags = (wait != 0) ? IORING_ENTER_GETEVENTS : 0u;
+            while (true) {
+                const auto result = ::syscall(__NR_io_uring_enter, descriptor, queued, wait, flags, nullptr, 0);
+                if (result >= 0) {
+                    queued -= static_cast<unsigned>(result);
+                    return;
+                }
+                if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                    throw std::ios::failure{std::format("Failed to submit reads: {}", std::strerror(errno))};
+                }
+            }
+        }
+
+        auto finish(std::size_t slot, std::exception_ptr error) -> void {
+            auto& read = *reads[slot];
+            ::close(read.descriptor);
+            if (error) {
+                read.content.clear();
+            }
+
+            ready.push_back({.index = read.index, .content = std::move(read.content), .error = std::move(error)});
+            reads[slot].reset();
+            free_reads.push_back(slot);
+            active--;
+        }
+
+        // short reads are queued again for the rest of the file
+        auto complete(std::size_t slot, int result, const std::vector<std::filesystem::path>& paths) -> void {
+            auto& read = *reads[slot];
+            if (result == -EINTR || result == -EAGAIN) {
+                queue_read(slot);
+            } else if (result == -EINVAL || result == -EOPNOTSUPP) {
+                // a kernel without IORING_OP_READ (before 5.6), the file is read right here instead
+                const auto error = read_rest(read.descriptor, read.content, read.done);
+                finish(slot, (error != 0) ? failure(paths[read.index], "read", error) : nullptr);
+            } else if (result < 0) {
+                finish(slot, failure(paths[read.index], "read", -result));
+            } else if (result == 0) {
+                read.content.resize(read.done);  // the file shrank since it was opened
+                finish(slot, nullptr);
+            } else if (read.done += static_cast<std::size_t>(result); read.done < read.content.size()) {
+                queue_read(slot);
+            } else {
+                finish(slot, nullptr);
+            }
+        }
+
+        auto reap(const std::vector<std::filesystem::path>& paths) -> void {
+            auto       head = *cq_head;
+            const auto tail = std::atomic_ref{*cq_tail}.load(std::memory_order_acquire);
+            for (; head != tail; head++) {
+                const auto& entry = cqes[head & cq_mask];
+                complete(static_cast<std::size_t>(entry.user_data), entry.res, paths);
+            }
+            std::atomic_ref{*cq_head}.store(head, std::memory_order_release);
+        }
+    };
+
+    FileLoader::FileLoader(std::vector<std::filesystem::path> paths, std::size_t in_flight)
+        : paths_{std::move(paths)}
+        , in_flight_{std::clamp(in_flight, std::size_t{1}, std::size_t{4096})}
+        , ring_{Ring::create(in_flight_)} {}
+
+    FileLoader::~FileLoader() {
+        if (ring_ && ring_->active != 0) {
+            // the kernel may still write into the buffers, wait for every pending read before they go away
+            while (ring_->active != 0) {
+                ring_->enter(1);
+                ring_->reap(paths_);
+            }
+        }
+    }
+
+    auto FileLoader::next() -> std::optional<LoadedFile> {
+        auto lock = std::unique_lock{mutex_};
+        if (not ring_) {
+            if (started_ == paths_.size()) {
+                return std::nullopt;
+            }
+
+            const auto index = started_++;
+            lock.unlock();
+            return read_now(paths_[index], index);
+        }
+
+        while (ring_->ready.empty()) {
+            start_reads();
+            if (not ring_->ready.empty()) {
+                break;
+            }
+            if (ring_->active == 0) {
+                return std::nullopt;
+            }
+
+            ring_->enter(1);
+            ring_->reap(paths_);
+        }
+
+        auto file = std::move(ring_->ready.front());
+        ring_->ready.pop_front();
+        return file;
+    }
+
+    auto FileLoader::start_reads() -> void {
+        while (ring_->active < in_flight_ && started_ != paths_.size()) {
+            const auto  index = started_++;
+            const auto& path  = paths_[index];
+
+            const auto descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (descriptor == -1) {
+                ring_->ready.push_back({.index = index, .error = failure(path, "open", errno)});
+                continue;
+            }
+
+            // files without a known size (pipes, /proc) are read on the spot
+            struct stat info {};
+            if (::fstat(descriptor, &info) == -1 || not S_ISREG(info.st_mode) || info.st_size == 0) {
+                ::close(descriptor);
+                ring_->ready.push_back(read_now(path, index));
+                continue;
+            }
+
+            const auto slot = ring_->free_reads.back();
+            ring_->free_reads.pop_back();
+            ring_->reads[slot].emplace(Ring::Read{
+                .index      = index,
+                .descriptor = descriptor,
+                .content    = std::string(static_cast<std::size_t>(info.st_size), '\0'),
+            });
+            ring_->active++;
+            ring_->queue_read(slot);
+        }
+
+        if (ring_->queued != 0) {
+            ring_->enter(0);
+        }
+    }
+}  // namespace core::io
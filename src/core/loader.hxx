@@ -0,0 +1,64 @@
+#ifndef CORE_LOADER_HXX
+#define CORE_LOADER_HXX
+
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+
+namespace core::io {
+    // A file read by `FileLoader`: its content, or the reason it couldn't be read.
+    struct LoadedFile {
+        std::size_t        index = 0;  // position of the path in the list given to the loader
+        std::string        content{};
+        std::exception_ptr error{};
+    };
+
+    // Reads a list of files ahead of the workers that consume them, so I/O overlaps with solving.
+    //
+    // Up to `in_flight` reads are kept queued on an io_uring and files are handed out in the order they complete.
+    // Where io_uring is unavailable (old kernels, seccomp profiles of containers) every `next` call reads its
+    // file with plain blocking reads instead, still outside of the lock so workers read in parallel.
+    class FileLoader {
+    public:
+        static constexpr auto DEFAULT_IN_FLIGHT = std::size_t{32};
+
+    public:
+        explicit FileLoader(std::vector<std::filesystem::path> paths, std::size_t in_flight = DEFAULT_IN_FLIGHT);
+
+        FileLoader(const FileLoader&) = delete;
+        FileLoader(FileLoader&&)      = delete;
+
+        auto operator=(const FileLoader&) -> FileLoader& = delete;
+        auto operator=(FileLoader&&) -> FileLoader&      = delete;
+
+        ~FileLoader();
+
+        // Next loaded file, empty once every file has been handed out. Safe to call from several threads.
+        auto next() -> std::optional<LoadedFile>;
+
+        [[nodiscard]] auto uses_io_uring() const -> bool {
+            return ring_ != nullptr;
+        }
+
+    private:
+        struct Ring;
+
+        // queues reads until `in_flight_` of them are pending, called with the lock held
+        auto start_reads() -> void;
+
+    private:
+        std::vector<std::filesystem::path> paths_;
+        std::size_t                        in_flight_;
+        std::unique_ptr<Ring>              ring_;  // null when falling back to plain reads
+        std::mutex                         mutex_;
+        std::size_t                        started_ = 0;  // paths whose read has been started or done
+    };
+}  // namespace core::io
+
+#endif  // CORE_LOADER_HXX
@@ -4,14 +4,14 @@
 #include <core/strings.hxx>
 
 #include <charconv>
+#include <cstddef>
 #include <format>
 #include <istream>
 #include <iterator>
-#include <sstream>
 #include <stdexcept>
-#include <string>
 #include <string_view>
 #include <system_error>
+#include <type_traits>
 #include <vector>
 
 
@@ -38,6 +38,39 @@ namespace core::numbers {
         return number;
     }
 
+    // Appends every integer found in `record` to `numbers` and returns how many were parsed.
+    // Anything that isn't part of a number separates numbers, '-' is honoured for signed types only.
+    // The output is never cleared here, so a caller can reuse one buffer across many records.
+    template<typename Number, typename Allocator>
+    auto parse_numbers_into(std::string_view record, std::vector<Number, Allocator>& numbers) -> std::size_t {
+        const auto is_digit = [](char symbol) { return symbol >= '0' && symbol <= '9'; };
+
+        const auto initial_size = numbers.size();
+
+        const auto* cursor = record.data();
+        const auto* end    = record.data() + record.size();
+        while (cursor != end) {
+            if (!is_digit(*cursor)) {
+                const auto is_negative = std::is_signed_v<Number> && *cursor == '-';
+                if (!is_negative || (cursor + 1 == end) || !is_digit(*(cursor + 1))) {
+                    cursor++;
+                    continue;
+                }
+            }
+
+            Number     number = 0;
+            const auto result = std::from_chars(cursor, end, number);
+            if (result.ec != std::errc{}) {
+                throw std::runtime_error(std::format("Failed to parse integer from <{}>", record));
+            }
+
+            numbers.push_back(number);
+            cursor = result.ptr;
+        }
+
+        return numbers.size() - initial_size;
+    }
+
     template<typename Number>
     auto parse_numbers(std::istream& stream) -> std::vector<Number> {
         auto numbers = std::vector<Number>{};
@@ -47,8 +80,9 @@ namespace core::numbers {
 
     template<typename Number>
     auto parse_numbers(std::string_view record) -> std::vector<Number> {
-        auto stream = std::istringstream{std::string{record}};
-        return parse_numbers<Number>(stream);
+        auto numbers = std::vector<Number>{};
+        parse_numbers_into(record, numbers);
+        return numbers;
     }
 
 }  // namespace core::numbers
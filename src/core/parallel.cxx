@@ -0,0 +1,80 @@
+#include <core/parallel.hxx>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+
+namespace core::parallel {
+    namespace {
+        // Outlives the call: a helper task that only starts once every chunk is done still reads `next`.
+        struct Progress {
+            std::atomic<std::size_t>                next = 0;
+            std::size_t                             count;
+            const std::function<void(std::size_t)>* chunk;
+            std::mutex                              mutex;
+            std::condition_variable                 finished_all;
+            std::size_t                             finished = 0;
+            std::exception_ptr                      error;
+
+            Progress(std::size_t count, const std::function<void(std::size_t)>& chunk)
+                : count{count}
+                , chunk{&chunk} {}
+
+            auto work() -> void {
+                for (auto index = next++; index < count; index = next++) {
+                    auto failure = std::exception_ptr{};
+                    try {
+                        (*chunk)(index);
+                    } catch (...) {
+                        failure = std::current_exception();
+                    }
+
+                    const auto lock = std::scoped_lock{mutex};
+                    if (failure && !error) {
+                        error = std::move(failure);
+                    }
+                    if (++finished == count) {
+                        finished_all.notify_all();
+                    }
+                }
+            }
+        };
+    }  // namespace
+
+    auto pool() -> ThreadPool& {
+        static auto shared = ThreadPool{};
+        return shared;
+    }
+
+    auto for_each_chunk(ThreadPool& pool, std::size_t count, const std::function<void(std::size_t)>& chunk) -> void {
+        if (count <= 1 || ThreadPool::in_worker() || pool.size() <= 1) {
+            for (auto index = 0ul; index != count; index++) {
+                chunk(index);
+            }
+            return;
+        }
+
+        const auto progress = std::make_shared<Progress>(count, chunk);
+        for (auto helper = std::min(pool.size(), count - 1); helper != 0; helper--) {
+            pool.submit([progress] { progress->work(); });
+        }
+        progress->work();
+
+        auto lock = std::unique_lock{progress->mutex};
+        progress->finished_all.wait(lock, [&] { return progress->finished == count; });
+        if (progress->error) {
+            // taken out, a late helper may still drop the last reference to the progress
+            std::rethrow_exception(std::exchange(progress->error, nullptr));
+        }
+    }
+
+    auto for_each_chunk(std::size_t count, const std::function<void(std::size_t)>& chunk) -> void {
+        for_each_chunk(pool(), count, chunk);
+    }
+}  // namespace core::parallel
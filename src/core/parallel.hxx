@@ -0,0 +1,83 @@
+#ifndef CORE_PARALLEL_HXX
+#define CORE_PARALLEL_HXX
+
+#include <core/thread-pool.hxx>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace core::parallel {
+    // records folded by one task unless the caller knows better, puzzle sized inputs stay in a few chunks
+    constexpr auto DEFAULT_GRAIN = std::size_t{256};
+
+    // Pool shared by the helpers, one worker per hardware thread, started on first use.
+    auto pool() -> ThreadPool&;
+
+    // Calls `chunk(i)` for every `i` in [0, count) on `pool` and rethrows the first exception once all calls are over.
+    //
+    // The calling thread takes chunks too, so a call never waits on work nobody picked up. Called from the worker
+    // of any pool (e.g. the batch workers, which already keep every core busy) it runs everything inline.
+    auto for_each_chunk(ThreadPool& pool, std::size_t count, const std::function<void(std::size_t)>& chunk) -> void;
+
+    // the same on the shared pool
+    auto for_each_chunk(std::size_t count, const std::function<void(std::size_t)>& chunk) -> void;
+
+    // `reduce(...reduce(reduce(init, transform(v0)), transform(v1))...)` over a sized random access range, with the
+    // chunks of `grain` records folded in parallel.
+    //
+    // Chunk boundaries depend only on `grain` and the partial results are combined in chunk order, so the result
+    // is the same for every thread count. `reduce` must be associative for it to match a sequential fold.
+    template<std::ranges::random_access_range Range, typename Result, typename Reduce, typename Transform>
+        requires std::ranges::sized_range<Range>
+    auto transform_reduce(
+        ThreadPool& pool, const Range& values, Result init, Reduce reduce, Transform transform,
+        std::size_t grain = DEFAULT_GRAIN
+    ) -> Result {
+        const auto size   = static_cast<std::size_t>(std::ranges::size(values));
+        grain             = std::max(grain, std::size_t{1});
+        const auto chunks = (size + grain - 1) / grain;
+
+        auto partials = std::vector<std::optional<Result>>(chunks);
+        for_each_chunk(pool, chunks, [&](std::size_t chunk) {
+            const auto first = std::ranges::begin(values) + static_cast<std::ptrdiff_t>(chunk * grain);
+            const auto count = static_cast<std::ptrdiff_t>(std::min(grain, size - chunk * grain));
+
+            auto partial = static_cast<Result>(std::invoke(transform, *first));
+            for (auto it = std::next(first); it != first + count; ++it) {
+                partial = std::invoke(reduce, std::move(partial), std::invoke(transform, *it));
+            }
+            partials[chunk].emplace(std::move(partial));
+        });
+
+        for (auto& partial : partials) {
+            init = std::invoke(reduce, std::move(init), std::move(*partial));
+        }
+        return init;
+    }
+
+    // the same on the shared pool
+    template<std::ranges::random_access_range Range, typename Result, typename Reduce, typename Transform>
+        requires std::ranges::sized_range<Range>
+    auto transform_reduce(
+        const Range& values, Result init, Reduce reduce, Transform transform, std::size_t grain = DEFAULT_GRAIN
+    ) -> Result {
+        return transform_reduce(pool(), values, std::move(init), std::move(reduce), std::move(transform), grain);
+    }
+
+    // plain sum of `transform` over the records
+    template<std::ranges::random_access_range Range, typename Result, typename Transform>
+        requires std::ranges::sized_range<Range>
+    auto sum(const Range& values, Result init, Transform transform, std::size_t grain = DEFAULT_GRAIN) -> Result {
+        return transform_reduce(values, std::move(init), std::plus<Result>{}, std::move(transform), grain);
+    }
+}  // namespace core::parallel
+
+#endif  // CORE_PARALLEL_HXX
@@ -0,0 +1,131 @@
+#ifndef CORE_PIPELINE_HXX
+#define CORE_PIPELINE_HXX
+
+#include <core/generator.hxx>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace core {
+    // Bounded queue between two threads; `push` blocks while it's full and `pop` while it's empty.
+    // Once closed, pushes are refused and pops drain what's left.
+    template<typename T>
+    class Channel {
+    public:
+        explicit Channel(std::size_t capacity)
+            : capacity_{capacity == 0 ? 1 : capacity} {}
+
+        // false if the channel was closed, the value is dropped then
+        auto push(T value) -> bool {
+            auto lock = std::unique_lock{mutex_};
+            not_full_.wait(lock, [this] { return closed_ or values_.size() < capacity_; });
+            if (closed_) {
+                return false;
+            }
+            values_.push_back(std::move(value));
+            not_empty_.notify_one();
+            return true;
+        }
+
+        // empty once the channel is closed and drained
+        auto pop() -> std::optional<T> {
+            auto lock = std::unique_lock{mutex_};
+            not_empty_.wait(lock, [this] { return closed_ or not values_.empty(); });
+            if (values_.empty()) {
+                return std::nullopt;
+            }
+            auto value = std::move(values_.front());
+            values_.pop_front();
+            not_full_.notify_one();
+            return value;
+        }
+
+        auto close() -> void {
+            const auto lock = std::lock_guard{mutex_};
+            closed_         = true;
+            not_full_.notify_all();
+            not_empty_.notify_all();
+        }
+
+    private:
+        std::size_t             capacity_;
+        std::mutex              mutex_;
+        std::condition_variable not_full_;
+        std::condition_variable not_empty_;
+        std::deque<T>           values_;
+        bool                    closed_ = false;
+    };
+
+    // Runs `source` on a thread of its own, up to `depth` chunks of `chunk` values ahead of the consumer, so
+    // producing the next values (typically reading and parsing records) overlaps with consuming the current ones.
+    //
+    // The values cross threads and must own their data: a view into a reader's buffer is stale by the time it's
+    // consumed. An exception of the source is rethrown to the consumer after the values produced before it.
+    // Dropping the result early stops the source at its next chunk.
+    template<typename T>
+    auto prefetch(Generator<T> source, std::size_t depth = 4, std::size_t chunk = 256) -> Generator<T> {
+        struct Chunk {
+            std::vector<T>     values;
+            std::exception_ptr error;
+        };
+
+        class CloseOnExit {
+        public:
+            explicit CloseOnExit(Channel<Chunk>& channel)
+                : channel_{channel} {}
+
+            CloseOnExit(const CloseOnExit&) = delete;
+            CloseOnExit(CloseOnExit&&)      = delete;
+
+            auto operator=(const CloseOnExit&) -> CloseOnExit& = delete;
+            auto operator=(CloseOnExit&&) -> CloseOnExit&      = delete;
+
+            ~CloseOnExit() {
+                channel_.close();
+            }
+
+        private:
+            Channel<Chunk>& channel_;
+        };
+
+        auto channel  = Channel<Chunk>{depth};
+        auto producer = std::jthread{[&channel, &source, chunk] {
+            auto current = Chunk{};
+            try {
+                for (auto& value : source) {
+                    current.values.push_back(std::move(value));
+                    if (current.values.size() >= chunk and not channel.push(std::exchange(current, Chunk{}))) {
+                        return;
+                    }
+                }
+            } catch (...) {
+                current.error = std::current_exception();
+            }
+            if (not current.values.empty() or current.error) {
+                channel.push(std::move(current));
+            }
+            channel.close();
+        }};
+        // destroyed before the producer is joined, unblocks a producer waiting on a full channel
+        const auto closer = CloseOnExit{channel};
+
+        while (auto current = channel.pop()) {
+            for (auto& value : current->values) {
+                co_yield std::move(value);
+            }
+            if (current->error) {
+                std::rethrow_exception(current->error);
+            }
+        }
+    }
+}  // namespace core
+
+#endif  // CORE_PIPELINE_HXX
@@ -0,0 +1,244 @@
+#include <core/profile.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace core::profile {
+    namespace {
+        // gauges set in a hot loop are thinned out to keep the trace small, the summary still sees every value
+        constexpr auto GAUGE_SAMPLE_PERIOD = std::chrono::microseconds{10};
+
+        struct ZoneEvent {
+            const char*       name = nullptr;
+            Clock::time_point start;
+            Clock::time_point finish;
+        };
+
+        struct GaugeSample {
+            const char*       name = nullptr;
+            Clock::time_point time;
+            std::int64_t      value = 0;
+        };
+
+        struct Gauge {
+            const char*       name  = nullptr;
+            std::int64_t      last  = 0;
+            std::int64_t      max   = std::numeric_limits<std::int64_t>::min();
+            Clock::time_point sampled{};
+        };
+
+        struct Counter {
+            const char*  name  = nullptr;
+            std::int64_t total = 0;
+        };
+
+        // Everything one thread recorded. Counters and gauges are few, so a linear scan beats a map here.
+        struct ThreadLog {
+            std::size_t              thread = 0;
+            std::vector<ZoneEvent>   zones;
+            std::vector<GaugeSample> samples;
+            std::vector<Gauge>       gauges;
+            std::vector<Counter>     counters;
+        };
+
+        struct Registry {
+            std::mutex                              mutex;
+            Clock::time_point                       epoch = Clock::now();
+            std::vector<std::shared_ptr<ThreadLog>> logs;
+        };
+
+        auto registry() -> Registry& {
+            static auto instance = Registry{};
+            return instance;
+        }
+
+        // created during static initialization, so the trace epoch precedes every zone
+        [[maybe_unused]] const auto& EARLY_REGISTRY = registry();
+
+        template<typename Entry>
+        auto find_entry(std::vector<Entry>& entries, const char* name) -> Entry& {
+            const auto it = std::ranges::find_if(entries, [name](const Entry& entry) {
+                return entry.name == name || std::string_view{entry.name} == name;
+            });
+            if (it != entries.end()) {
+                return *it;
+            }
+            return entries.emplace_back(Entry{.name = name});
+        }
+
+        auto escape(std::string_view str) -> std::string {
+            auto escaped = std::string{};
+            for (const auto symbol : str) {
+                if (symbol == '"' || symbol == '\\') {
+                    escaped += '\\';
+                }
+                escaped += symbol;
+            }
+            return escaped;
+        }
+
+        auto microseconds(Clock::duration duration) -> double {
+            return std::chrono::duration<double, std::micro>(duration).count();
+        }
+
+#ifdef CORE_PROFILE
+        // the log outlives its thread, the registry keeps it for the final report
+        auto thread_log() -> ThreadLog& {
+            thread_local const auto log = [] {
+                auto& instance  = registry();
+                const auto lock = std::scoped_lock{instance.mutex};
+
+                auto created    = std::make_shared<ThreadLog>();
+                created->thread = instance.logs.size() + 1;
+                instance.logs.push_back(created);
+                return created;
+            }();
+            return *log;
+        }
+#endif
+    }  // namespace
+
+#ifdef CORE_PROFILE
+    auto record_zone(const char* name, Clock::time_point start, Clock::time_point finish) -> void {
+        thread_log().zones.push_back({name, start, finish});
+    }
+
+    auto add_count(const char* name, std::int64_t delta) -> void {
+        find_entry(thread_log().counters, name).total += delta;
+    }
+
+    auto set_gauge(const char* name, std::int64_t value) -> void {
+        auto& log   = thread_log();
+        auto& gauge = find_entry(log.gauges, name);
+        gauge.last  = value;
+        gauge.max   = std::max(gauge.max, value);
+
+        if (const auto now = Clock::now(); now - gauge.sampled >= GAUGE_SAMPLE_PERIOD) {
+            gauge.sampled = now;
+            log.samples.push_back({name, now, value});
+        }
+    }
+#endif
+
+    auto write_summary(std::ostream& stream) -> void {
+        struct ZoneTotals {
+            std::size_t     calls = 0;
+            Clock::duration total{};
+            Clock::duration max{};
+        };
+
+        auto zones    = std::map<std::string_view, ZoneTotals>{};
+        auto counters = std::map<std::string_view, std::int64_t>{};
+        auto gauges   = std::map<std::string_view, Gauge>{};
+
+        auto& instance  = registry();
+        const auto lock = std::scoped_lock{instance.mutex};
+        for (const auto& log : instance.logs) {
+            for (const auto& [name, start, finish] : log->zones) {
+                auto& totals = zones[name];
+                totals.calls++;
+                totals.total += finish - start;
+                totals.max = std::max(totals.max, finish - start);
+            }
+            for (const auto& [name, total] : log->counters) {
+                counters[name] += total;
+            }
+            for (const auto& gauge : log->gauges) {
+                auto& merged = gauges.try_emplace(gauge.name, gauge).first->second;
+                merged.last  = gauge.last;
+                merged.max   = std::max(merged.max, gauge.max);
+            }
+        }
+
+        auto order = std::vector<std::pair<std::string_view, ZoneTotals>>{zones.begin(), zones.end()};
+        std::ranges::sort(order, std::ranges::greater{}, [](const auto& entry) { return entry.second.total; });
+
+        stream << std::format("{:<32} {:>10} {:>14} {:>14} {:>14}\n", "zone", "calls", "total, us", "mean, us", "max, us");
+        for (const auto& [name, totals] : order) {
+            const auto total = microseconds(totals.total);
+            stream << std::format(
+                "{:<32} {:>10} {:>14.1f} {:>14.3f} {:>14.3f}\n", name, totals.calls, total,
+                total / static_cast<double>(totals.calls), microseconds(totals.max)
+            );
+        }
+
+        if (not counters.empty()) {
+            stream << std::format("\n{:<32} {:>10}\n", "counter", "total");
+            for (const auto& [name, total] : counters) {
+                stream << std::format("{:<32} {:>10}\n", name, total);
+            }
+        }
+
+        if (not gauges.empty()) {
+            stream << std::format("\n{:<32} {:>10} {:>10}\n", "gauge", "last", "max");
+            for (const auto& [name, gauge] : gauges) {
+                stream << std::format("{:<32} {:>10} {:>10}\n", name, gauge.last, gauge.max);
+            }
+        }
+    }
+
+    auto write_trace(std::ostream& stream) -> void {
+        auto& instance  = registry();
+        const auto lock = std::scoped_lock{instance.mutex};
+
+        const auto timestamp = [&](Clock::time_point time) { return microseconds(time - instance.epoch); };
+
+        auto separator = "\n    ";
+        stream << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+        for (const auto& log : instance.logs) {
+            for (const auto& [name, start, finish] : log->zones) {
+                stream << std::format(
+                    R"({}{{"name": "{}", "ph": "X", "pid": 1, "tid": {}, "ts": {:.3f}, "dur": {:.3f}}})", separator,
+                    escape(name), log->thread, timestamp(start), microseconds(finish - start)
+                );
+                separator = ",\n    ";
+            }
+
+            for (const auto& [name, time, value] : log->samples) {
+                stream << std::format(
+                    R"({}{{"name": "{}", "ph": "C", "pid": 1, "tid": {}, "ts": {:.3f}, "args": {{"value": {}}}}})",
+                    separator, escape(name), log->thread, timestamp(time), value
+                );
+                separator = ",\n    ";
+            }
+
+            // counters only have totals, they are shown once at the end of their thread
+            auto last = instance.epoch;
+            for (const auto& zone : log->zones) {
+                last = std::max(last, zone.finish);
+            }
+            for (const auto& [name, total] : log->counters) {
+                stream << std::format(
+                    R"({}{{"name": "{}", "ph": "C", "pid": 1, "tid": {}, "ts": {:.3f}, "args": {{"total": {}}}}})",
+                    separator, escape(name), log->thread, timestamp(last), total
+                );
+                separator = ",\n    ";
+            }
+        }
+        stream << "\n]}\n";
+    }
+
+    auto reset() -> void {
+        auto& instance  = registry();
+        const auto lock = std::scoped_lock{instance.mutex};
+        for (const auto& log : instance.logs) {
+            log->zones.clear();
+            log->samples.clear();
+            log->gauges.clear();
+            log->counters.clear();
+        }
+        instance.epoch = Clock::now();
+    }
+}  // namespace core::profile
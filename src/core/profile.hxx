@@ -0,0 +1,82 @@
+#ifndef CORE_PROFILE_HXX
+#define CORE_PROFILE_HXX
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+
+// Hot-path instrumentation. Only builds configured with AOC_PROFILE=ON (which defines CORE_PROFILE) record
+// anything; otherwise the macros expand to nothing and their arguments are never evaluated.
+//
+//   CORE_PROFILE_ZONE("day-17/dijkstra");           // times the enclosing scope
+//   CORE_PROFILE_COUNT("day-17/pops", 1);           // adds to a running total
+//   CORE_PROFILE_GAUGE("day-17/queue", queue.size()); // samples a level
+//
+// Names must be string literals, the recorder keeps the pointers.
+namespace core::profile {
+    using Clock = std::chrono::steady_clock;
+
+    [[nodiscard]] constexpr auto enabled() -> bool {
+#ifdef CORE_PROFILE
+        return true;
+#else
+        return false;
+#endif
+    }
+
+#ifdef CORE_PROFILE
+    auto record_zone(const char* name, Clock::time_point start, Clock::time_point finish) -> void;
+    auto add_count(const char* name, std::int64_t delta) -> void;
+    auto set_gauge(const char* name, std::int64_t value) -> void;
+
+    class Zone {
+    public:
+        explicit Zone(const char* name)
+            : name_{name}
+            , start_{Clock::now()} {}
+
+        Zone(const Zone&) = delete;
+        Zone(Zone&&)      = delete;
+
+        auto operator=(const Zone&) -> Zone& = delete;
+        auto operator=(Zone&&) -> Zone&      = delete;
+
+        ~Zone() {
+            record_zone(name_, start_, Clock::now());
+        }
+
+    private:
+        const char*       name_;
+        Clock::time_point start_;
+    };
+#endif
+
+    // The reports read the log of every thread without locking it, so recording must be over first. Threads that
+    // outlive the work they recorded (e.g. pool workers) are fine once that work has been waited for, as
+    // ThreadPool::wait or the return of a core::parallel call does.
+
+    // Per zone: calls, total, mean and max time; per counter: total; per gauge: last and max value.
+    auto write_summary(std::ostream& stream) -> void;
+
+    // Chrome trace-event JSON, loadable by chrome://tracing and Perfetto.
+    auto write_trace(std::ostream& stream) -> void;
+
+    // drops everything recorded so far, must not race with recording threads
+    auto reset() -> void;
+}  // namespace core::profile
+
+#ifdef CORE_PROFILE
+#define CORE_PROFILE_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define CORE_PROFILE_CONCAT(lhs, rhs)      CORE_PROFILE_CONCAT_IMPL(lhs, rhs)
+
+#define CORE_PROFILE_ZONE(name)         const ::core::profile::Zone CORE_PROFILE_CONCAT(profile_zone_, __LINE__){name}
+#define CORE_PROFILE_COUNT(name, delta) ::core::profile::add_count(name, static_cast<std::int64_t>(delta))
+#define CORE_PROFILE_GAUGE(name, value) ::core::profile::set_gauge(name, static_cast<std::int64_t>(value))
+#else
+#define CORE_PROFILE_ZONE(name)         static_cast<void>(0)
+#define CORE_PROFILE_COUNT(name, delta) static_cast<void>(0)
+#define CORE_PROFILE_GAUGE(name, value) static_cast<void>(0)
+#endif
+
+#endif  // CORE_PROFILE_HXX
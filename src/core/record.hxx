@@ -0,0 +1,248 @@
+#ifndef CORE_RECORD_HXX
+#define CORE_RECORD_HXX
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+// Record layouts checked and split into steps at compile time, e.g.
+//
+//   core::record::parse<"{x=%u,m=%u,a=%u,s=%u}">(line, part.x, part.m, part.a, part.s);
+//
+//   %u  unsigned integer into an unsigned integral field
+//   %d  integer with an optional '-' into a signed integral field
+//   %s  std::string_view field up to the character that follows it in the layout, or up to the end
+//   %c  single char field
+//   %%  literal '%'
+//   ' ' any run of spaces, including none
+//
+// Everything else must match literally. Nothing is allocated and there is no stream or locale involved.
+namespace core::record {
+    template<std::size_t Size>
+    struct Layout {
+        // NOLINTNEXTLINE(google-explicit-constructor): layouts are written as string literals
+        consteval Layout(const char (&text)[Size]) {
+            std::copy_n(text, Size, chars);
+        }
+
+        [[nodiscard]] constexpr auto view() const -> std::string_view {
+            return {chars, Size - 1};
+        }
+
+        char chars[Size]{};  // NOLINT: has to be a public array to be usable as a template argument
+    };
+}  // namespace core::record
+
+
+namespace core::record::detail {
+    enum class Kind : std::uint8_t {
+        LITERAL,
+        SPACE,
+        UNSIGNED,
+        SIGNED,
+        WORD,
+        CHAR,
+    };
+
+    struct Step {
+        Kind        kind   = Kind::LITERAL;
+        std::size_t offset = 0;  // literal text in the layout
+        std::size_t size   = 0;
+        char        until  = 0;  // the character ending a word, zero for the end of the record
+    };
+
+    [[nodiscard]] constexpr auto is_field(Kind kind) -> bool {
+        return kind != Kind::LITERAL && kind != Kind::SPACE;
+    }
+
+    // Splits the layout into steps and hands them to `emit` in order. Counting and storing the steps both go
+    // through here, so they agree on every step. A literal is a run of the layout text, which makes "%%" start a
+    // literal of its own at the second '%'.
+    template<typename Emit>
+    constexpr auto scan(std::string_view text, Emit emit) -> void {
+        auto literal    = Step{.kind = Kind::LITERAL};  // the literal being extended, none while its size is zero
+        auto last_space = false;
+
+        const auto flush = [&] {
+            if (literal.size != 0) {
+                emit(literal);
+                literal.size = 0;
+                last_space   = false;
+            }
+        };
+        const auto push = [&](Step step) {
+            flush();
+            if (step.kind != Kind::SPACE || not last_space) {
+                emit(step);
+            }
+            last_space = step.kind == Kind::SPACE;
+        };
+
+        for (auto index = 0ul; index != text.size(); index++) {
+            if (text[index] == ' ') {
+                push(Step{.kind = Kind::SPACE});
+                continue;
+            }
+
+            if (text[index] == '%') {
+                if (index + 1 == text.size()) {
+                    throw std::invalid_argument("a layout can't end with a lone '%'");
+                }
+
+                switch (text[++index]) {
+                    case 'u': push(Step{.kind = Kind::UNSIGNED}); continue;
+                    case 'd': push(Step{.kind = Kind::SIGNED}); continue;
+                    case 's': push(Step{.kind = Kind::WORD}); continue;
+                    case 'c': push(Step{.kind = Kind::CHAR}); continue;
+                    case '%': flush(); break;  // a literal '%', the second one is the text to match
+                    default: throw std::invalid_argument("unknown layout directive");
+                }
+            }
+
+            // everything else flushes the literal, so it always ends right before `index`
+            if (literal.size == 0) {
+                literal.offset = index;
+            }
+            literal.size++;
+        }
+        flush();
+    }
+
+    // steps are counted before they are stored, the array size must be a constant
+    template<Layout layout>
+    consteval auto count_steps() -> std::size_t {
+        auto count = 0ul;
+        scan(layout.view(), [&](const Step& /*step*/) { count++; });
+        return count;
+    }
+
+    template<Layout layout>
+    consteval auto make_steps() -> std::array<Step, count_steps<layout>()> {
+        const auto text = layout.view();
+
+        auto steps = std::array<Step, count_steps<layout>()>{};
+        auto count = 0ul;
+        scan(text, [&](const Step& step) { steps[count++] = step; });
+
+        // a word runs until whatever follows it
+        for (auto index = 0ul; index != count; index++) {
+            if (steps[index].kind != Kind::WORD || index + 1 == count) {
+                continue;
+            }
+
+            const auto& next = steps[index + 1];
+            if (is_field(next.kind)) {
+                throw std::invalid_argument("%s has to be followed by a literal, a space or the end of the layout");
+            }
+            steps[index].until = (next.kind == Kind::SPACE) ? ' ' : text[next.offset];
+        }
+        return steps;
+    }
+
+    // "a", "%b", a space, a field and "%": the literal after a "%%" is a step of its own
+    static_assert(make_steps<"a%%b  %u%%">().size() == 5 && make_steps<"a%%b  %u%%">()[1].offset == 2);
+
+    template<std::size_t Size>
+    consteval auto field_index(const std::array<Step, Size>& steps, std::size_t step) -> std::size_t {
+        return static_cast<std::size_t>(
+            std::count_if(steps.begin(), steps.begin() + static_cast<std::ptrdiff_t>(step), [](const Step& entry) {
+                return is_field(entry.kind);
+            })
+        );
+    }
+
+    template<Layout layout, Step step, typename Field>
+    auto apply(const char*& cursor, const char* end, Field& field) -> bool {
+        if constexpr (step.kind == Kind::LITERAL) {
+            constexpr auto literal = layout.view().substr(step.offset, step.size);
+            if (static_cast<std::size_t>(end - cursor) < literal.size()
+                || not std::equal(literal.begin(), literal.end(), cursor)) {
+                return false;
+            }
+            cursor += literal.size();
+            return true;
+        } else if constexpr (step.kind == Kind::SPACE) {
+            while (cursor != end && *cursor == ' ') {
+                cursor++;
+            }
+            return true;
+        } else if constexpr (step.kind == Kind::UNSIGNED || step.kind == Kind::SIGNED) {
+            if constexpr (step.kind == Kind::UNSIGNED) {
+                static_assert(std::is_integral_v<Field> && std::is_unsigned_v<Field>, "%u needs an unsigned field");
+            } else {
+                static_assert(std::is_integral_v<Field> && std::is_signed_v<Field>, "%d needs a signed field");
+            }
+
+            const auto [next, error] = std::from_chars(cursor, end, field);
+            cursor                   = next;
+            return error == std::errc{};
+        } else if constexpr (step.kind == Kind::WORD) {
+            static_assert(std::is_same_v<Field, std::string_view>, "%s needs a std::string_view field");
+
+            const auto* const last = (step.until != 0) ? std::find(cursor, end, step.until) : end;
+            field                  = std::string_view{cursor, last};
+            cursor                 = last;
+            return true;
+        } else {
+            static_assert(std::is_same_v<Field, char>, "%c needs a char field");
+
+            if (cursor == end) {
+                return false;
+            }
+            field = *cursor++;
+            return true;
+        }
+    }
+}  // namespace core::record::detail
+
+
+namespace core::record {
+    // Matches the start of `record` against the layout and fills the fields in order. Returns the part of
+    // the record that follows the match, nothing on a mismatch (the fields may be partially written then).
+    template<Layout layout, typename... Fields>
+    auto parse(std::string_view record, Fields&... fields) -> std::optional<std::string_view> {
+        static constexpr auto STEPS = detail::make_steps<layout>();
+        static_assert(
+            std::ranges::count_if(STEPS, [](const detail::Step& step) { return detail::is_field(step.kind); })
+                == sizeof...(Fields),
+            "every directive of the layout needs exactly one field"
+        );
+
+        const auto* cursor  = record.data();
+        const auto* end     = record.data() + record.size();
+        auto        targets = std::tie(fields...);
+
+        // steps without a field get a dummy to keep the fold uniform
+        const auto matched = [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+            auto none = 0;
+            return (
+                [&] {
+                    constexpr auto STEP = STEPS[Index];
+                    if constexpr (detail::is_field(STEP.kind)) {
+                        return detail::apply<layout, STEP>(cursor, end, std::get<detail::field_index(STEPS, Index)>(targets));
+                    } else {
+                        return detail::apply<layout, STEP>(cursor, end, none);
+                    }
+                }()
+                && ...
+            );
+        }(std::make_index_sequence<STEPS.size()>{});
+
+        if (not matched) {
+            return std::nullopt;
+        }
+        return std::string_view{cursor, end};
+    }
+}  // namespace core::record
+
+#endif  // CORE_RECORD_HXX
@@ -0,0 +1,160 @@
+#include <core/scan.hxx>
+
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define CORE_SCAN_X86 1
+#endif
+
+
+namespace core::scan {
+    namespace {
+        using FindKernel  = std::size_t (*)(const char* data, std::size_t size, char symbol);
+        using CountKernel = std::size_t (*)(const char* data, std::size_t size, char symbol);
+
+        struct Kernels {
+            std::string_view name;
+            FindKernel       find  = nullptr;
+            CountKernel      count = nullptr;
+        };
+
+        auto find_scalar(const char* data, std::size_t size, char symbol) -> std::size_t {
+            const auto* const found = static_cast<const char*>(std::memchr(data, symbol, size));
+            return (found != nullptr) ? static_cast<std::size_t>(found - data) : std::string_view::npos;
+        }
+
+        auto count_scalar(const char* data, std::size_t size, char symbol) -> std::size_t {
+            auto total = std::size_t{0};
+            for (auto i = 0ul; i != size; i++) {
+                total += static_cast<std::size_t>(data[i] == symbol);
+            }
+            return total;
+        }
+
+#ifdef CORE_SCAN_X86
+        constexpr auto SSE2_WIDTH = 16ul;
+        constexpr auto AVX2_WIDTH = 32ul;
+
+        auto find_sse2(const char* data, std::size_t size, char symbol) -> std::size_t {
+            const auto needle = _mm_set1_epi8(symbol);
+
+            auto offset = 0ul;
+            for (; offset + SSE2_WIDTH <= size; offset += SSE2_WIDTH) {
+                const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));  // NOLINT
+                const auto mask  = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+                if (mask != 0) {
+                    return offset + std::countr_zero(mask);
+                }
+            }
+
+            const auto tail = find_scalar(data + offset, size - offset, symbol);
+            return (tail != std::string_view::npos) ? offset + tail : tail;
+        }
+
+        auto count_sse2(const char* data, std::size_t size, char symbol) -> std::size_t {
+            const auto needle = _mm_set1_epi8(symbol);
+
+            auto total  = std::size_t{0};
+            auto offset = 0ul;
+            for (; offset + SSE2_WIDTH <= size; offset += SSE2_WIDTH) {
+                const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));  // NOLINT
+                const auto mask  = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+                total += std::popcount(mask);
+            }
+
+            return total + count_scalar(data + offset, size - offset, symbol);
+        }
+
+        __attribute__((target("avx2"))) auto find_avx2(const char* data, std::size_t size, char symbol) -> std::size_t {
+            const auto needle = _mm256_set1_epi8(symbol);
+
+            auto offset = 0ul;
+            for (; offset + AVX2_WIDTH <= size; offset += AVX2_WIDTH) {
+                const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset));  // NOLINT
+                const auto mask  = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle)));
+                if (mask != 0) {
+                    return offset + std::countr_zero(mask);
+                }
+            }
+
+            const auto tail = find_sse2(data + offset, size - offset, symbol);
+            return (tail != std::string_view::npos) ? offset + tail : tail;
+        }
+
+        __attribute__((target("avx2"))) auto count_avx2(const char* data, std::size_t size, char symbol) -> std::size_t {
+            const auto needle = _mm256_set1_epi8(symbol);
+
+            auto total  = std::size_t{0};
+            auto offset = 0ul;
+            for (; offset + AVX2_WIDTH <= size; offset += AVX2_WIDTH) {
+                const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset));  // NOLINT
+                const auto mask  = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle)));
+                total += std::popcount(mask);
+            }
+
+            return total + count_sse2(data + offset, size - offset, symbol);
+        }
+#endif
+
+        auto select_kernels() -> Kernels {
+#ifdef CORE_SCAN_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) {
+                return {"avx2", find_avx2, count_avx2};
+            }
+
+            // SSE2 is part of the x86-64 baseline
+            return {"sse2", find_sse2, count_sse2};
+#else
+            return {"scalar", find_scalar, count_scalar};
+#endif
+        }
+
+        auto kernels() -> const Kernels& {
+            static const auto selected = select_kernels();
+            return selected;
+        }
+    }  // namespace
+
+    auto find(std::string_view source, char symbol, std::size_t offset) -> std::size_t {
+        if (offset >= source.size()) {
+            return std::string_view::npos;
+        }
+
+        const auto position = kernels().find(source.data() + offset, source.size() - offset, symbol);
+        return (position != std::string_view::npos) ? offset + position : position;
+    }
+
+    auto find(std::string_view source, std::string_view delimiter, std::size_t offset) -> std::size_t {
+        if (delimiter.empty()) {
+            return (offset <= source.size()) ? offset : std::string_view::npos;
+        }
+
+        if (delimiter.size() > source.size()) {
+            return std::string_view::npos;
+        }
+
+        // scan for the first byte of the delimiter and verify the rest of it in place
+        const auto last     = source.size() - delimiter.size();
+        auto       position = find(source, delimiter.front(), offset);
+        while (position != std::string_view::npos && position <= last) {
+            if (source.compare(position, delimiter.size(), delimiter) == 0) {
+                return position;
+            }
+            position = find(source, delimiter.front(), position + 1);
+        }
+        return std::string_view::npos;
+    }
+
+    auto count(std::string_view source, char symbol) -> std::size_t {
+        return kernels().count(source.data(), source.size(), symbol);
+    }
+
+    auto kernel_name() -> std::string_view {
+        return kernels().name;
+    }
+}  // namespace core::scan
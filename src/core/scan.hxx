@@ -0,0 +1,20 @@
+#ifndef CORE_SCAN_HXX
+#define CORE_SCAN_HXX
+
+#include <cstddef>
+#include <string_view>
+
+
+namespace core::scan {
+    // Vectorized single-byte search. The widest kernel supported by the CPU (AVX2, SSE2 or scalar)
+    // is picked once at runtime and then reused by every call.
+    auto find(std::string_view source, char symbol, std::size_t offset = 0) -> std::size_t;
+    auto find(std::string_view source, std::string_view delimiter, std::size_t offset = 0) -> std::size_t;
+    auto count(std::string_view source, char symbol) -> std::size_t;
+
+    // name of the selected kernel, handy for benchmark reports
+    auto kernel_name() -> std::string_view;
+}  // namespace core::scan
+
+
+#endif  // CORE_SCAN_HXX
@@ -0,0 +1,34 @@
+#ifndef CORE_SOLUTION_HXX
+#define CORE_SOLUTION_HXX
+
+#include <string>
+#include <string_view>
+
+
+namespace core::cache {
+    class Store;
+}  // namespace core::cache
+
+
+namespace core::io {
+    class LineReader;
+}  // namespace core::io
+
+
+namespace core {
+    // answers are kept as text, days disagree on the integer types and some have no second part
+    struct Answers {
+        std::string part_one;
+        std::string part_two;
+    };
+
+    using Solver = auto (*)(std::string_view input) -> Answers;
+
+    // consumes the input record by record, its memory doesn't grow with the length of the input
+    using StreamSolver = auto (*)(io::LineReader& input) -> Answers;
+
+    // loads the parsed model from the cache when the same input was parsed before
+    using CachedSolver = auto (*)(std::string_view input, const cache::Store& store) -> Answers;
+}  // namespace core
+
+#endif  // CORE_SOLUTION_HXX
@@ -1,18 +1,53 @@
+#include <core/scan.hxx>
 #include <core/strings.hxx>
 
 #include <algorithm>
 #include <iterator>
-#include <ranges>
 #include <string_view>
 #include <vector>
 
 
 namespace core::strings {
+    SplitView::Iterator::Iterator(std::string_view source, std::string_view delimiter)
+        : source_{source}
+        , delimiter_{delimiter}
+        , done_{source.empty()} {
+        find_end();
+    }
+
+    auto SplitView::Iterator::operator++() -> Iterator& {
+        if (end_ == source_.size()) {
+            done_ = true;
+            return *this;
+        }
+
+        start_ = end_ + delimiter_.size();
+        if (delimiter_.empty() && start_ == source_.size()) {
+            // an empty delimiter splits into single characters, there is no trailing part
+            done_ = true;
+            return *this;
+        }
+
+        find_end();
+        return *this;
+    }
+
+    auto SplitView::Iterator::find_end() -> void {
+        if (delimiter_.empty()) {
+            end_ = std::min(start_ + 1, source_.size());
+            return;
+        }
+
+        end_ = std::min(scan::find(source_, delimiter_, start_), source_.size());
+    }
+
+    auto split_view(std::string_view source, std::string_view delimiter) -> SplitView {
+        return {source, delimiter};
+    }
+
     auto split(std::string_view source, std::string_view delimiter) -> std::vector<std::string_view> {
         auto parts = std::vector<std::string_view>{};
-        std::ranges::transform(std::views::split(source, delimiter), std::back_inserter(parts), [](const auto&& subrange) {
-            return std::string_view{subrange.data(), subrange.size()};
-        });
+        std::ranges::copy(split_view(source, delimiter), std::back_inserter(parts));
         return parts;
     }
 
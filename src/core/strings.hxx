@@ -1,14 +1,89 @@
 #ifndef CORE_STRINGS_HXX
 #define CORE_STRINGS_HXX
 
+#include <cstddef>
+#include <iterator>
+#include <ranges>
 #include <string_view>
 #include <vector>
 
 
 namespace core::strings {
+    // Lazy counterpart of `split`: parts are produced one by one while iterating, nothing is allocated.
+    // Follows `std::views::split` semantics: a trailing delimiter yields a trailing empty part.
+    class SplitView : public std::ranges::view_interface<SplitView> {
+    public:
+        class Iterator {
+        public:
+            using value_type       = std::string_view;
+            using difference_type  = std::ptrdiff_t;
+            using iterator_concept = std::forward_iterator_tag;
+
+        public:
+            Iterator() = default;
+
+            auto operator*() const -> std::string_view {
+                return source_.substr(start_, end_ - start_);
+            }
+
+            auto operator++() -> Iterator&;
+
+            auto operator++(int) -> Iterator {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            auto operator==(const Iterator& other) const -> bool {
+                return (done_ == other.done_) && (done_ || start_ == other.start_);
+            }
+
+            auto operator==(std::default_sentinel_t) const -> bool {
+                return done_;
+            }
+
+        private:
+            friend class SplitView;
+
+            Iterator(std::string_view source, std::string_view delimiter);
+
+            auto find_end() -> void;
+
+        private:
+            std::string_view source_;
+            std::string_view delimiter_;
+            std::size_t      start_ = 0;
+            std::size_t      end_   = 0;
+            bool             done_  = true;
+        };
+
+    public:
+        SplitView() = default;
+
+        SplitView(std::string_view source, std::string_view delimiter)
+            : source_{source}
+            , delimiter_{delimiter} {}
+
+        [[nodiscard]] auto begin() const -> Iterator {
+            return {source_, delimiter_};
+        }
+
+        [[nodiscard]] auto end() const -> std::default_sentinel_t {
+            return std::default_sentinel;
+        }
+
+    private:
+        std::string_view source_;
+        std::string_view delimiter_;
+    };
+
+    auto split_view(std::string_view source, std::string_view delimiter) -> SplitView;
     auto split(std::string_view source, std::string_view delimiter) -> std::vector<std::string_view>;
     auto strip(std::string_view str, std::string_view chars = "\n\r\t ") -> std::string_view;
 }  // namespace core::strings
 
+template<>
+inline constexpr bool std::ranges::enable_borrowed_range<core::strings::SplitView> = true;
+
 
 #endif  // CORE_STRINGS_HXX
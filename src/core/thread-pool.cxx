@@ -0,0 +1,140 @@
+#include <core/thread-pool.hxx>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+
+namespace core {
+    namespace {
+        // identifies the pool and the queue of the worker running on this thread
+        thread_local const ThreadPool* current_pool  = nullptr;
+        thread_local std::size_t       current_queue = 0;
+    }  // namespace
+
+    ThreadPool::ThreadPool(std::size_t size) {
+        if (size == 0) {
+            size = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        for (auto index = 0ul; index != size; index++) {
+            queues_.push_back(std::make_unique<Queue>());
+        }
+
+        threads_.reserve(size);
+        for (auto index = 0ul; index != size; index++) {
+            threads_.emplace_back([this, index] { run(index); });
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            const auto lock = std::scoped_lock{mutex_};
+            stopping_       = true;
+        }
+        wake_.notify_all();
+
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    auto ThreadPool::submit(Task task) -> void {
+        // counted before it becomes visible, so neither counter can underflow when a worker grabs it at once
+        {
+            const auto lock = std::scoped_lock{mutex_};
+            pending_++;
+            queued_++;
+        }
+
+        const auto index = (current_pool == this) ? current_queue : next_queue_++ % queues_.size();
+        {
+            const auto lock = std::scoped_lock{queues_[index]->mutex};
+            queues_[index]->tasks.push_back(std::move(task));
+        }
+        wake_.notify_one();
+    }
+
+    auto ThreadPool::in_worker() -> bool {
+        return current_pool != nullptr;
+    }
+
+    auto ThreadPool::wait() -> void {
+        auto lock = std::unique_lock{mutex_};
+        idle_.wait(lock, [this] { return pending_ == 0; });
+
+        if (error_) {
+            std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+    }
+
+    auto ThreadPool::run(std::size_t index) -> void {
+        current_pool  = this;
+        current_queue = index;
+
+        auto task = Task{};
+        while (true) {
+            if (try_pop(index, task)) {
+                auto error = std::exception_ptr{};
+                try {
+                    task();
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                task = nullptr;
+                finish_task(error);
+                continue;
+            }
+
+            auto lock = std::unique_lock{mutex_};
+            wake_.wait(lock, [this] { return stopping_ || queued_ != 0; });
+            if (stopping_ && queued_ == 0) {
+                return;
+            }
+        }
+    }
+
+    auto ThreadPool::try_pop(std::size_t index, Task& task) -> bool {
+        // own deque from the back: the task submitted last is the one whose data is still in cache
+        {
+            auto& own       = *queues_[index];
+            const auto lock = std::scoped_lock{own.mutex};
+            if (not own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                queued_--;
+                return true;
+            }
+        }
+
+        // steal from the front of the others, starting with the neighbour to spread the contention
+        for (auto offset = 1ul; offset != queues_.size(); offset++) {
+            auto& victim    = *queues_[(index + offset) % queues_.size()];
+            const auto lock = std::scoped_lock{victim.mutex};
+            if (not victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                queued_--;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    auto ThreadPool::finish_task(std::exception_ptr error) -> void {
+        auto lock = std::unique_lock{mutex_};
+        if (error && !error_) {
+            error_ = std::move(error);
+        }
+
+        if (--pending_ == 0) {
+            lock.unlock();
+            idle_.notify_all();
+        }
+    }
+}  // namespace core
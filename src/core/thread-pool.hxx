@@ -0,0 +1,84 @@
+#ifndef CORE_THREAD_POOL_HXX
+#define CORE_THREAD_POOL_HXX
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace core {
+    // Fixed set of workers with a task deque each. A worker takes its own newest task first and steals the
+    // oldest task of another worker once its deque runs dry, so uneven tasks still keep every core busy.
+    class ThreadPool {
+    public:
+        using Task = std::function<void()>;
+
+    public:
+        // one worker per hardware thread by default
+        explicit ThreadPool(std::size_t size = 0);
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool(ThreadPool&&)      = delete;
+
+        auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+        auto operator=(ThreadPool&&) -> ThreadPool&      = delete;
+
+        // finishes the queued tasks before joining the workers
+        ~ThreadPool();
+
+        [[nodiscard]] auto size() const -> std::size_t {
+            return threads_.size();
+        }
+
+        // tasks submitted from a worker go to its own deque, the rest are spread round-robin
+        auto submit(Task task) -> void;
+
+        // true on the worker threads of any pool
+        [[nodiscard]] static auto in_worker() -> bool;
+
+        // Blocks until every submitted task has finished, must not be called from a task.
+        // Rethrows the first exception that escaped a task since the previous `wait`.
+        auto wait() -> void;
+
+    private:
+        struct Queue {
+            std::mutex       mutex;
+            std::deque<Task> tasks;
+        };
+
+        auto run(std::size_t index) -> void;
+        auto try_pop(std::size_t index, Task& task) -> bool;
+        auto finish_task(std::exception_ptr error) -> void;
+
+    private:
+        std::vector<std::unique_ptr<Queue>> queues_;
+        std::vector<std::thread>            threads_;
+        std::atomic<std::size_t>            next_queue_ = 0;
+        std::atomic<std::size_t>            queued_     = 0;
+
+        std::mutex              mutex_;
+        std::condition_variable wake_;
+        std::condition_variable idle_;
+        std::size_t             pending_  = 0;
+        bool                    stopping_ = false;
+        std::exception_ptr      error_;
+    };
+
+    // Calls `function(i)` for every `i` in [0, count) on the pool and waits for all of them.
+    template<typename Function>
+    auto parallel_for(ThreadPool& pool, std::size_t count, Function function) -> void {
+        for (auto index = 0ul; index != count; index++) {
+            pool.submit([&function, index] { function(index); });
+        }
+        pool.wait();
+    }
+}  // namespace core
+
+#endif  // CORE_THREAD_POOL_HXX
@@ -0,0 +1,15 @@
+#include "trebuchet.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+auto main() -> int {
+    const auto data   = core::io::MappedFile{std::filesystem::path{"input.data"}};
+    const auto result = day_1::part_one(day_1::parse(data.view()));
+    std::cout << std::format("The sum of all calibration values is {}", result);
+    return 0;
+}
@@ -1,12 +1,20 @@
+#include "trebuchet.hxx"
+
+#include <core/cache.hxx>
+#include <core/io.hxx>
+#include <core/parallel.hxx>
+#include <core/strings.hxx>
+
 #include <algorithm>
 #include <cctype>
+#include <cstddef>
 #include <cstdint>
 #include <format>
-#include <fstream>
-#include <iostream>
 #include <iterator>
 #include <numeric>
 #include <optional>
+#include <span>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -14,16 +22,16 @@
 
 
 namespace {
-    auto load_data(const std::string& path) -> std::vector<std::string> {
-        std::ifstream file{path};
+    using day_1::Document;
 
-        std::vector<std::string> data;
-        std::copy(std::istream_iterator<std::string>(file), std::istream_iterator<std::string>(), std::back_inserter(data));
-        return data;
-    }
+    // the calibration value of every line, what a cached run loads instead of the document
+    using Calibrations = std::vector<std::int32_t>;
+
+    // bumped whenever the serialized calibrations change
+    constexpr auto CACHE_SCHEMA = std::uint32_t{2};
 
 
-    auto extract_digits(const std::string& str) -> std::vector<std::int32_t> {
+    auto extract_digits(std::string_view str) -> std::vector<std::int32_t> {
         // Ordered list of spelled-out digits, longest words first to handle overlaps
         const std::vector<std::tuple<std::string_view, int>> digit_words = {
             {"eight", 8}, {"seven", 7}, {"three", 3}, {"nine", 9}, {"four", 4},
@@ -59,7 +67,7 @@ namespace {
     }
 
 
-    auto get_calibration_digits(const std::string& str) -> std::optional<std::tuple<std::int32_t, std::int32_t>> {
+    auto get_calibration_digits(std::string_view str) -> std::optional<std::tuple<std::int32_t, std::int32_t>> {
         auto matches = extract_digits(str);
         if (matches.empty()) {
             // No digits found
@@ -70,7 +78,7 @@ namespace {
     }
 
 
-    auto get_calibration_value(const std::string& str) -> std::int32_t {
+    auto get_calibration_value(std::string_view str) -> std::int32_t {
         const auto digits = get_calibration_digits(str);
         if (!digits) {
             return 0;
@@ -81,19 +89,54 @@ namespace {
     }
 
 
-    auto get_calibration_values(const std::vector<std::string>& data) -> std::vector<std::int32_t> {
-        std::vector<std::int32_t> calibrations;
-        calibrations.reserve(data.size());
-        std::ranges::transform(data, std::back_inserter(calibrations), get_calibration_value);
+    auto get_calibrations(std::string_view input) -> Calibrations {
+        const auto document = day_1::parse(input);
+
+        auto calibrations = Calibrations{};
+        calibrations.reserve(document.size());
+        std::ranges::transform(document, std::back_inserter(calibrations), get_calibration_value);
         return calibrations;
     }
+
+    auto save(const Calibrations& calibrations, core::cache::Writer& writer) -> void {
+        writer.write_span(std::span{calibrations});
+    }
+
+    auto load(core::cache::Reader& reader) -> Calibrations {
+        const auto calibrations = reader.read_span<std::int32_t>();
+        return {calibrations.begin(), calibrations.end()};
+    }
 }  // namespace
 
 
-auto main() -> int {
-    const auto data         = load_data("input.data");
-    const auto calibrations = get_calibration_values(data);
-    const auto result       = std::reduce(calibrations.cbegin(), calibrations.cend());
-    std::cout << std::format("The sum of all calibration values is {}", result);
-    return 0;
-}
+namespace day_1 {
+    auto parse(std::string_view input) -> Document {
+        auto stream = std::ispanstream{input};
+
+        Document data;
+        std::copy(std::istream_iterator<std::string>(stream), std::istream_iterator<std::string>(),
+                  std::back_inserter(data));
+        return data;
+    }
+
+    auto part_one(const Document& document) -> std::int64_t {
+        return core::parallel::sum(document, std::int64_t{0}, get_calibration_value);
+    }
+
+    auto solve(std::string_view input) -> core::Answers {
+        return {std::format("{}", part_one(parse(input))), {}};
+    }
+
+    auto solve_stream(core::io::LineReader& input) -> core::Answers {
+        auto total = std::int64_t{0};
+        while (const auto line = input.next()) {
+            total += get_calibration_value(core::strings::strip(*line));
+        }
+        return {std::format("{}", total), {}};
+    }
+
+    auto solve_cached(std::string_view input, const core::cache::Store& store) -> core::Answers {
+        const auto calibrations = store.load_or_parse("day-1", CACHE_SCHEMA, input, get_calibrations, save, load);
+        return {std::format("{}", std::accumulate(calibrations.begin(), calibrations.end(), std::int64_t{0})), {}};
+    }
+}  // namespace day_1
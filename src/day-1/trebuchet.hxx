@@ -0,0 +1,27 @@
+#ifndef TREBUCHET_HXX
+#define TREBUCHET_HXX
+
+#include <core/solution.hxx>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace core::cache {
+    class Store;
+}  // namespace core::cache
+
+
+namespace day_1 {
+    using Document = std::vector<std::string>;
+
+    auto parse(std::string_view input) -> Document;
+    auto part_one(const Document& document) -> std::int64_t;
+    auto solve(std::string_view input) -> core::Answers;
+    auto solve_stream(core::io::LineReader& input) -> core::Answers;
+    auto solve_cached(std::string_view input, const core::cache::Store& store) -> core::Answers;
+}  // namespace day_1
+
+#endif  // TREBUCHET_HXX
@@ -0,0 +1,21 @@
+#include "pipe-maze.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto maze_data = core::io::MappedFile{std::filesystem::path{"input.data"}};
+    const auto maze_grid = day_10::parse(maze_data.view());
+
+    const auto steps_numbers = day_10::part_one(maze_grid);
+    std::cout << std::format("The farthest point is {} steps away\n", steps_numbers);
+
+    const auto enclosed_tiles = day_10::part_two(maze_grid);
+    std::cout << std::format("There are {} tiles enclosed by loop\n", enclosed_tiles);
+
+    return 0;
+}
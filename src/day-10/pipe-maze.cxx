@@ -1,51 +1,27 @@
-#include <core/io.hxx>
-#include <core/strings.hxx>
+#include "pipe-maze.hxx"
+
+#include <core/arena.hxx>
+#include <core/coordinate.hxx>
+#include <core/flat-hash.hxx>
+#include <core/grid.hxx>
+#include <core/profile.hxx>
 
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <format>
 #include <functional>
-#include <iostream>
 #include <iterator>
-#include <queue>
 #include <ranges>
-#include <string>
 #include <string_view>
 #include <unordered_map>
-#include <unordered_set>
 #include <utility>
-#include <vector>
 
 
 namespace {
-    using Grid = std::vector<std::string_view>;
-
-    struct Coordinate {
-        std::int64_t row = 0;
-        std::int64_t col = 0;
-
-        auto operator==(const Coordinate& other) const -> bool = default;
-
-        [[nodiscard]] constexpr Coordinate operator+(const Coordinate& other) const {
-            return Coordinate{
-                .row = row + other.row,
-                .col = col + other.col,
-            };
-        }
-    };
-}  // namespace
+    using day_10::Grid;
+    using Coordinate = core::Coordinate;
 
-template<>
-struct std::hash<Coordinate> {
-    auto operator()(const Coordinate& coordinate) const noexcept -> std::size_t {
-        const auto row_hash = std::hash<std::int64_t>{}(coordinate.row);
-        const auto col_hash = std::hash<std::int64_t>{}(coordinate.col);
-        return row_hash ^ (col_hash << 1);
-    }
-};
-
-namespace {
     const auto OFFSETS_MAPPING = std::unordered_map<char, std::pair<Coordinate, Coordinate>>{
         {'|', {{-1, 0}, {+1, 0}}},  // north <-> south
         {'-', {{0, -1}, {0, +1}}},  // west  <-> east
@@ -63,34 +39,16 @@ namespace {
     }
 
     auto find_start_position(const Grid& grid) -> Coordinate {
-        for (auto row = 0ul; row != grid.size(); row++) {
-            for (auto col = 0ul; col < grid[0].size(); col++) {
-                if (grid[row][col] == 'S') {
-                    return {
-                        .row = static_cast<std::int64_t>(row),
-                        .col = static_cast<std::int64_t>(col),
-                    };
-                }
-            }
+        const auto start = std::ranges::find(grid.cells(), 'S');
+        if (start == grid.cells().end()) {
+            return {};
         }
-        return {};
+        return grid.coordinate(std::distance(grid.cells().begin(), start));
     }
 
     auto check_step(const Grid& grid, Coordinate from, Coordinate to) -> bool {
-        if (to.row < 0 || to.col < 0) {
-            return false;
-        }
-
-        if (to.row >= std::ssize(grid)) {
-            return false;
-        }
-
-        if (to.col >= std::ssize(grid[to.row])) {
-            return false;
-        }
-
-        // does the destination pipe connect to the source?
-        auto [first, second] = get_tile_directions(grid[to.row][to.col]);
+        // the grid is padded with ground tiles, so stepping outside is just a step onto a tile without pipes
+        auto [first, second] = get_tile_directions(grid[to]);
         return !((from != to + first) && (from != to + second));
     };
 
@@ -123,10 +81,12 @@ namespace {
     }
 
     auto count_numbers_of_step(const Grid& grid) -> std::size_t {
+        CORE_PROFILE_ZONE("day-10/loop-bfs");
+
         // BFS:
         // track of visited spaces and distance we visited them
-        auto visited = std::unordered_map<Coordinate, std::int64_t>{};
-        auto queue   = std::queue<std::pair<Coordinate, std::int64_t>>{};
+        auto visited = core::FlatHashMap<Coordinate, std::int64_t>{};
+        auto queue   = core::Queue<std::pair<Coordinate, std::int64_t>>{core::memory_resource()};
         queue.emplace(find_start_position(grid), 0);
         visited[queue.front().first] = 0;
 
@@ -148,9 +108,10 @@ namespace {
         while (not queue.empty()) {
             const auto [coord, distance] = queue.front();
             queue.pop();
+            CORE_PROFILE_COUNT("day-10/visited", 1);
 
             // expand into each direction -  two of the directions must succeed only!
-            if (grid[coord.row][coord.col] == 'S') {
+            if (grid[coord] == 'S') {
                 try_move(coord, {coord.row + 1, coord.col}, distance + 1);
                 try_move(coord, {coord.row - 1, coord.col}, distance + 1);
                 try_move(coord, {coord.row, coord.col + 1}, distance + 1);
@@ -159,13 +120,13 @@ namespace {
             }
 
             // there is nothing to do in empty spaces, but we should never step into a space
-            if (grid[coord.row][coord.col] == '.') {
+            if (grid[coord] == '.') {
                 continue;
             }
 
             // try to visit the two directions the current shape connects to
             const auto new_distance    = distance + 1;
-            const auto [first, second] = get_tile_directions(grid[coord.row][coord.col]);
+            const auto [first, second] = get_tile_directions(grid[coord]);
             if (try_move(coord, coord + first, new_distance) || try_move(coord, coord + second, new_distance)) {
                 return new_distance;
             }
@@ -174,15 +135,17 @@ namespace {
     }
 
     auto count_enclosed_tiles(const Grid& grid) -> std::size_t {
-        auto       visited    = std::unordered_map<Coordinate, std::int64_t>{};
-        auto       queue      = std::queue<std::pair<Coordinate, std::int64_t>>{};
+        CORE_PROFILE_ZONE("day-10/enclosed-bfs");
+
+        auto       visited    = core::FlatHashMap<Coordinate, std::int64_t>{};
+        auto       queue      = core::Queue<std::pair<Coordinate, std::int64_t>>{core::memory_resource()};
         const auto start      = find_start_position(grid);
         const auto start_tile = find_start_tile(grid, start);
         queue.emplace(start, 0);
         visited[start] = 0;
 
         const auto get_tile = [&](Coordinate pos) {
-            const auto tile = grid[pos.row][pos.col];
+            const auto tile = grid[pos];
             if (tile == 'S') {
                 return start_tile;
             }
@@ -192,6 +155,7 @@ namespace {
         while (!queue.empty()) {
             const auto [coord, distance] = queue.front();
             queue.pop();
+            CORE_PROFILE_COUNT("day-10/visited", 1);
 
             const auto tile = get_tile(coord);
             if (tile == '.') {
@@ -215,15 +179,15 @@ namespace {
 
 
         // Prepare for the expanded BFS to count reachable tiles outside the loop
-        auto expanded_visited = std::unordered_set<Coordinate>{};
-        auto expanded_queue   = std::queue<Coordinate>{};
+        auto expanded_visited = core::FlatHashSet<Coordinate>{};
+        auto expanded_queue   = core::Queue<Coordinate>{core::memory_resource()};
 
         expanded_queue.emplace(0, 0);  // Start BFS from the top-left corner outside the grid
         expanded_visited.emplace(0, 0);
 
         const auto can_expand = [&](Coordinate pos) {
             // out of bounds check
-            if ((pos.row < 0) || (pos.col < 0) || (pos.row >= grid.size() * 2) || (pos.col >= grid[0].size() * 2)) {
+            if ((pos.row < 0) || (pos.col < 0) || (pos.row >= grid.rows() * 2) || (pos.col >= grid.cols() * 2)) {
                 return false;
             }
 
@@ -297,6 +261,7 @@ namespace {
         while (not expanded_queue.empty()) {
             const auto coord = expanded_queue.front();
             expanded_queue.pop();
+            CORE_PROFILE_COUNT("day-10/expanded", 1);
 
             const auto try_expand = [&](Coordinate next) {
                 if (can_expand(next)) {
@@ -311,7 +276,7 @@ namespace {
             try_expand({coord.row, coord.col + 1});
         }
 
-        auto encircled = std::ssize(grid) * std::ssize(grid[0]);
+        auto encircled = grid.rows() * grid.cols();
         encircled -= std::ranges::count_if(expanded_visited, [](Coordinate pos) {
             return (pos.row % 2 != 0) && (pos.col % 2 != 0);
         });
@@ -321,16 +286,22 @@ namespace {
     }
 }  // namespace
 
-int main() {
-    const auto path      = std::string{"input.data"};
-    const auto maze_data = core::io::read_file(path, true);
-    const auto maze_grid = core::strings::split(maze_data, "\n");
 
-    const auto steps_numbers = count_numbers_of_step(maze_grid);
-    std::cout << std::format("The farthest point is {} steps away\n", steps_numbers);
+namespace day_10 {
+    auto parse(std::string_view input) -> Grid {
+        return Grid::parse(input, 1, '.');
+    }
 
-    const auto enclosed_tiles = count_enclosed_tiles(maze_grid);
-    std::cout << std::format("There are {} tiles enclosed by loop\n", enclosed_tiles);
+    auto part_one(const Grid& grid) -> std::size_t {
+        return count_numbers_of_step(grid);
+    }
 
-    return 0;
-}
+    auto part_two(const Grid& grid) -> std::size_t {
+        return count_enclosed_tiles(grid);
+    }
+
+    auto solve(std::string_view input) -> core::Answers {
+        const auto grid = parse(input);
+        return {std::format("{}", part_one(grid)), std::format("{}", part_two(grid))};
+    }
+}  // namespace day_10
@@ -0,0 +1,20 @@
+#ifndef PIPE_MAZE_HXX
+#define PIPE_MAZE_HXX
+
+#include <core/grid.hxx>
+#include <core/solution.hxx>
+
+#include <cstddef>
+#include <string_view>
+
+
+namespace day_10 {
+    using Grid = core::Grid2D<char>;
+
+    auto parse(std::string_view input) -> Grid;
+    auto part_one(const Grid& grid) -> std::size_t;
+    auto part_two(const Grid& grid) -> std::size_t;
+    auto solve(std::string_view input) -> core::Answers;
+}  // namespace day_10
+
+#endif  // PIPE_MAZE_HXX
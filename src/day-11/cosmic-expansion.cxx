@@ -1,54 +1,39 @@
-#include <core/io.hxx>
-#include <core/strings.hxx>
+#include "cosmic-expansion.hxx"
+
+#include <core/coordinate.hxx>
+#include <core/grid.hxx>
 
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <format>
-#include <iostream>
 #include <iterator>
 #include <ranges>
-#include <string>
 #include <string_view>
 #include <vector>
 
 
 namespace {
-    using Grid = std::vector<std::string_view>;
-
-    struct Coordinate {
-        std::int64_t row = 0;
-        std::int64_t col = 0;
-    };
+    using day_11::Grid;
+    using Coordinate = core::Coordinate;
 
     auto sum_of_distances(const Grid& image, std::size_t expansion_size) -> std::size_t {
-        const auto all_space = [](const auto& range) {
-            return std::ranges::all_of(std::get<1>(range), [](char symbol) { return symbol == '.'; });
-        };
-
-        const auto column = [&](std::size_t col) {
-            return image | std::views::transform([col](std::string_view line) -> char { return line[col]; });
+        const auto all_space = [](const auto& cells) {
+            return std::ranges::all_of(cells, [](char symbol) { return symbol == '.'; });
         };
 
         // get indexes of empty lines and columns
         auto empty_rows = std::vector<std::int64_t>{};
-        std::ranges::copy(
-            image | std::views::enumerate | std::views::filter(all_space) | std::views::elements<0>,
-            std::back_inserter(empty_rows)
+        std::ranges::copy_if(
+            std::views::iota(Grid::Index{0}, image.rows()), std::back_inserter(empty_rows),
+            [&](Grid::Index row) { return all_space(image.row(row)); }
         );
 
-        const auto line_length   = std::ssize(image.front());
-        auto       empty_columns = std::vector<std::int64_t>{};
-        std::ranges::copy(
-            // clang-format off
-            std::views::iota(0, line_length)
-                | std::views::transform(column)
-                | std::views::enumerate
-                | std::views::filter(all_space)
-                | std::views::elements<0>,
-            // clang-format on
-            std::back_inserter(empty_columns)
+        auto empty_columns = std::vector<std::int64_t>{};
+        std::ranges::copy_if(
+            std::views::iota(Grid::Index{0}, image.cols()), std::back_inserter(empty_columns),
+            [&](Grid::Index col) { return all_space(image.column(col)); }
         );
 
         // Distance calculation helper
@@ -70,25 +55,10 @@ namespace {
 
         // Transform the map into the list of coordinates of galaxies then fold over the galaxies,
         // for each producing the sum of distances to all previously seen galaxies
-        // clang-format off
-        auto seen = std::vector<Coordinate>{};
-        auto all_galaxies = image
-            | std::views::enumerate
-            | std::views::transform([](auto&& e) {
-                auto&& [row, line] = e;
-                return line
-                    | std::views::enumerate
-                    | std::views::filter([](auto&& entry) {
-                          auto&& [_, symbol] = entry;
-                          return symbol == '#';
-                      })
-                    | std::views::transform([row](auto&& entry) {
-                          auto&& [col, symbol] = entry;
-                          return Coordinate{row, col};
-                      });
-                })
-            | std::views::join;
-        // clang-format on
+        auto seen         = std::vector<Coordinate>{};
+        auto all_galaxies = std::views::iota(Grid::Index{0}, std::ssize(image.cells()))
+                          | std::views::filter([&](Grid::Index index) { return image[index] == '#'; })
+                          | std::views::transform([&](Grid::Index index) { return image.coordinate(index); });
 
         return std::ranges::fold_left(all_galaxies, std::int64_t{0}, [&](std::int64_t result, Coordinate position) {
             const auto inner_result =
@@ -101,18 +71,22 @@ namespace {
     }
 }  // namespace
 
-int main() {
-    const auto path       = std::string{"input.data"};
-    const auto image_data = core::io::read_file(path, true);
-    const auto image      = core::strings::split(core::strings::strip(image_data), "\n");
 
-    const auto distances_sum = sum_of_distances(image, 2);
-    std::cout << std::format("The sum of distances for all galaxies after expansion is {}\n", distances_sum);
+namespace day_11 {
+    auto parse(std::string_view input) -> Grid {
+        return Grid::parse(input);
+    }
 
-    const auto distances_sum_with_old = sum_of_distances(image, 1'000'000);
-    std::cout << std::format(
-        "The sum of distances for all galaxies in an old universe after expansion is {}\n", distances_sum_with_old
-    );
+    auto part_one(const Grid& image) -> std::size_t {
+        return sum_of_distances(image, 2);
+    }
+
+    auto part_two(const Grid& image) -> std::size_t {
+        return sum_of_distances(image, 1'000'000);
+    }
 
-    return 0;
-}
+    auto solve(std::string_view input) -> core::Answers {
+        const auto image = parse(input);
+        return {std::format("{}", part_one(image)), std::format("{}", part_two(image))};
+    }
+}  // namespace day_11
@@ -0,0 +1,20 @@
+#ifndef COSMIC_EXPANSION_HXX
+#define COSMIC_EXPANSION_HXX
+
+#include <core/grid.hxx>
+#include <core/solution.hxx>
+
+#include <cstddef>
+#include <string_view>
+
+
+namespace day_11 {
+    using Grid = core::Grid2D<char>;
+
+    auto parse(std::string_view input) -> Grid;
+    auto part_one(const Grid& image) -> std::size_t;
+    auto part_two(const Grid& image) -> std::size_t;
+    auto solve(std::string_view input) -> core::Answers;
+}  // namespace day_11
+
+#endif  // COSMIC_EXPANSION_HXX
@@ -0,0 +1,23 @@
+#include "cosmic-expansion.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto image_data = core::io::MappedFile{std::filesystem::path{"input.data"}};
+    const auto image      = day_11::parse(image_data.view());
+
+    const auto distances_sum = day_11::part_one(image);
+    std::cout << std::format("The sum of distances for all galaxies after expansion is {}\n", distances_sum);
+
+    const auto distances_sum_with_old = day_11::part_two(image);
+    std::cout << std::format(
+        "The sum of distances for all galaxies in an old universe after expansion is {}\n", distances_sum_with_old
+    );
+
+    return 0;
+}
@@ -1,16 +1,21 @@
+#include "hot-springs.hxx"
+
+#include <core/generator.hxx>
 #include <core/io.hxx>
+#include <core/numbers.hxx>
+#include <core/parallel.hxx>
+#include <core/pipeline.hxx>
+#include <core/record.hxx>
+#include <core/strings.hxx>
 
 #include <algorithm>
 #include <cstddef>
-#include <filesystem>
 #include <format>
-#include <fstream>
 #include <functional>
-#include <iostream>
-#include <istream>
 #include <iterator>
 #include <ranges>
 #include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -19,25 +24,12 @@
 
 
 namespace {
-    struct Spring {
-        std::string              condition;
-        std::vector<std::size_t> damage_sizes;
-
-        friend auto operator>>(std::istream& stream, Spring& spring) -> std::istream& {
-            spring.condition = core::io::read<std::string>(stream);
-
-            spring.damage_sizes.clear();
-            while ((stream.peek() == ' ') || (stream.peek() == ',')) {
-                if (stream.peek() == ',') {
-                    stream.ignore();
-                }
+    using day_12::Spring;
+    using day_12::Springs;
 
-                spring.damage_sizes.push_back(core::io::read<std::size_t>(stream));
-            }
 
-            return stream;
-        }
-    };
+    // every spring runs its own memoized search, a few of them are enough to keep a worker busy
+    constexpr auto ARRANGEMENTS_GRAIN = std::size_t{16};
 
     using MemoKey = std::tuple<std::size_t, std::size_t, std::size_t>;
 
@@ -48,11 +40,6 @@ namespace {
         }
     };
 
-    auto load_springs(const std::filesystem::path& path) -> std::vector<Spring> {
-        auto stream = std::ifstream{path};
-        return core::io::read_sequence<Spring>(stream);
-    }
-
     auto find_possible_placements(std::size_t current_offset, std::size_t width, std::string_view condition)
         -> std::vector<std::size_t> {
         auto result = std::vector<std::size_t>{};
@@ -149,10 +136,8 @@ namespace {
         return count_valid_arrangements(0, required_positions, spring_instance.damage_sizes, group_placements, memo);
     }
 
-    auto calculate_total_arrangements(const std::vector<Spring>& springs) -> std::size_t {
-        return std::ranges::fold_left(springs, std::size_t{0}, [](std::size_t total, const Spring& spring_instance) {
-            return total + calculate_arrangements_for_spring(spring_instance);
-        });
+    auto calculate_total_arrangements(const Springs& springs) -> std::size_t {
+        return core::parallel::sum(springs, std::size_t{0}, calculate_arrangements_for_spring, ARRANGEMENTS_GRAIN);
     }
 
     auto unfold_spring(const Spring& spring) -> Spring {
@@ -177,32 +162,69 @@ namespace {
         return unfolded;
     }
 
-    auto unfold_springs(const std::vector<Spring>& springs) -> std::vector<Spring> {
-        auto unfolded_springs = std::vector<Spring>{};
+    auto calculate_total_arrangements_with_unfolding(const Springs& springs) -> std::size_t {
+        const auto unfolded_arrangements = [](const Spring& spring) {
+            return calculate_arrangements_for_spring(unfold_spring(spring));
+        };
+        return core::parallel::sum(springs, std::size_t{0}, unfolded_arrangements, ARRANGEMENTS_GRAIN);
+    }
 
-        unfolded_springs.reserve(springs.size());
-        for (const auto& original_spring : springs) {
-            unfolded_springs.push_back(unfold_spring(original_spring));
+    auto load_springs(core::io::LineReader& input) -> core::Generator<Spring> {
+        for (const auto record : core::io::records(input)) {
+            if (not record.empty()) {
+                co_yield Spring::load(record);
+            }
         }
+    }
+}  // namespace
 
-        return unfolded_springs;
+
+namespace day_12 {
+    auto Spring::load(std::string_view record) -> Spring {
+        // ???.### 1,1,3
+        auto condition = std::string_view{};
+        auto sizes     = std::string_view{};
+        if (not core::record::parse<"%s %s">(record, condition, sizes)) {
+            throw std::runtime_error(std::format("Failed to parse spring from <{}>", record));
+        }
+
+        auto spring      = Spring{};
+        spring.condition = condition;
+        core::numbers::parse_numbers_into(sizes, spring.damage_sizes);
+        return spring;
     }
 
-    auto calculate_total_arrangements_with_unfolding(const std::vector<Spring>& springs) -> std::size_t {
-        const auto unfolded_springs = unfold_springs(springs);
-        return calculate_total_arrangements(unfolded_springs);
+    auto parse(std::string_view input) -> Springs {
+        auto springs = Springs{};
+        for (const auto record : core::strings::split_view(input, "\n")) {
+            if (not record.empty()) {
+                springs.push_back(Spring::load(record));
+            }
+        }
+        return springs;
     }
-}  // namespace
 
-int main() {
-    const auto path    = std::filesystem::path{"input.data"};
-    const auto springs = load_springs(path);
+    auto part_one(const Springs& springs) -> std::size_t {
+        return calculate_total_arrangements(springs);
+    }
 
-    const auto total_arrangements = calculate_total_arrangements(springs);
-    std::cout << std::format("There are {} total possible arrangements\n", total_arrangements);
+    auto part_two(const Springs& springs) -> std::size_t {
+        return calculate_total_arrangements_with_unfolding(springs);
+    }
 
-    const auto total_arrangements_unfolded = calculate_total_arrangements_with_unfolding(springs);
-    std::cout << std::format("There are {} total possible arrangements after unfolding\n", total_arrangements_unfolded);
+    auto solve(std::string_view input) -> core::Answers {
+        const auto springs = parse(input);
+        return {std::format("{}", part_one(springs)), std::format("{}", part_two(springs))};
+    }
 
-    return 0;
-}
+    auto solve_stream(core::io::LineReader& input) -> core::Answers {
+        auto arrangements          = std::size_t{0};
+        auto unfolded_arrangements = std::size_t{0};
+        // the springs are read and parsed on another thread while the arrangements of earlier ones are counted
+        for (const auto& spring : core::prefetch(load_springs(input))) {
+            arrangements += calculate_arrangements_for_spring(spring);
+            unfolded_arrangements += calculate_arrangements_for_spring(unfold_spring(spring));
+        }
+        return {std::format("{}", arrangements), std::format("{}", unfolded_arrangements)};
+    }
+}  // namespace day_12
@@ -0,0 +1,29 @@
+#ifndef HOT_SPRINGS_HXX
+#define HOT_SPRINGS_HXX
+
+#include <core/solution.hxx>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace day_12 {
+    struct Spring {
+        std::string              condition;
+        std::vector<std::size_t> damage_sizes;
+
+        static auto load(std::string_view record) -> Spring;
+    };
+
+    using Springs = std::vector<Spring>;
+
+    auto parse(std::string_view input) -> Springs;
+    auto part_one(const Springs& springs) -> std::size_t;
+    auto part_two(const Springs& springs) -> std::size_t;
+    auto solve(std::string_view input) -> core::Answers;
+    auto solve_stream(core::io::LineReader& input) -> core::Answers;
+}  // namespace day_12
+
+#endif  // HOT_SPRINGS_HXX
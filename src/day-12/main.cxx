@@ -0,0 +1,21 @@
+#include "hot-springs.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto data    = core::io::MappedFile{std::filesystem::path{"input.data"}};
+    const auto springs = day_12::parse(data.view());
+
+    const auto total_arrangements = day_12::part_one(springs);
+    std::cout << std::format("There are {} total possible arrangements\n", total_arrangements);
+
+    const auto total_arrangements_unfolded = day_12::part_two(springs);
+    std::cout << std::format("There are {} total possible arrangements after unfolding\n", total_arrangements_unfolded);
+
+    return 0;
+}
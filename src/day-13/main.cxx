@@ -0,0 +1,21 @@
+#include "point-of-incidence.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto data  = core::io::MappedFile{std::filesystem::path{"input.data"}};
+    const auto notes = day_13::parse(data.view());
+
+    const auto summarized = day_13::part_one(notes);
+    std::cout << std::format("The summarized value of notes is {}\n", summarized);
+
+    const auto summarized_with_one_bit_error = day_13::part_two(notes);
+    std::cout << std::format("The summarized value with 1-bit error of notes is {}\n", summarized_with_one_bit_error);
+
+    return 0;
+}
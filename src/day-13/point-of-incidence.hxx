@@ -0,0 +1,37 @@
+#ifndef POINT_OF_INCIDENCE_HXX
+#define POINT_OF_INCIDENCE_HXX
+
+#include <core/solution.hxx>
+
+#include <cstdint>
+#include <istream>
+#include <span>
+#include <string_view>
+#include <vector>
+
+
+namespace day_13 {
+    struct Note {
+        std::vector<std::uint64_t> rows;
+        std::vector<std::uint64_t> cols;
+
+        friend auto operator>>(std::istream& stream, Note& note) -> std::istream&;
+
+        static auto find_longest_mirror_size(std::span<const std::uint64_t> rng) -> std::uint64_t;
+        static auto find_longest_mirror_size_with_one_bit_error(std::span<const uint64_t> rng) -> std::uint64_t;
+
+        [[nodiscard]] auto find_longest_row_mirror_size() const -> std::uint64_t;
+        [[nodiscard]] auto find_longest_col_mirror_size() const -> std::uint64_t;
+        [[nodiscard]] auto find_longest_row_mirror_size_with_one_bit_error() const -> std::uint64_t;
+        [[nodiscard]] auto find_longest_col_mirror_size_with_one_bit_error() const -> std::uint64_t;
+    };
+
+    using Notes = std::vector<Note>;
+
+    auto parse(std::string_view input) -> Notes;
+    auto part_one(const Notes& notes) -> std::uint64_t;
+    auto part_two(const Notes& notes) -> std::uint64_t;
+    auto solve(std::string_view input) -> core::Answers;
+}  // namespace day_13
+
+#endif  // POINT_OF_INCIDENCE_HXX
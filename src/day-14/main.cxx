@@ -0,0 +1,36 @@
+#include "parabolic-reflector-dish.hxx"
+
+#include <core/io.hxx>
+#include <core/profile.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto path = std::filesystem::path{"input.data"};
+    const auto map  = core::io::MappedFile{path};
+    const auto grid = day_14::parse(map.view());
+
+    // the zones close before the answers are printed, so they time the solving alone
+    const auto total_load = [&] {
+        CORE_PROFILE_ZONE("day-14/part-one");
+        return day_14::part_one(grid);
+    }();
+    std::cout << std::format("The total load is {}\n", total_load);
+
+    const auto simulations                 = day_14::SIMULATIONS;
+    const auto total_load_with_simulations = [&] {
+        CORE_PROFILE_ZONE("day-14/part-two");
+        return day_14::part_two(grid, simulations);
+    }();
+    std::cout << std::format("The total load after {} simulations is {}\n", simulations, total_load_with_simulations);
+
+    // stderr, so the profile never mixes with the answers on stdout
+    if constexpr (core::profile::enabled()) {
+        core::profile::write_summary(std::cerr);
+    }
+
+    return 0;
+}
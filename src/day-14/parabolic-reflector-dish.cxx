@@ -1,16 +1,13 @@
-#include <core/io.hxx>
-#include <core/strings.hxx>
+#include "parabolic-reflector-dish.hxx"
+
+#include <core/grid.hxx>
 
 #include <algorithm>
-#include <chrono>
 #include <cstddef>
 #include <cstdint>
-#include <filesystem>
 #include <format>
-#include <iostream>
 #include <iterator>
 #include <ranges>
-#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -18,6 +15,8 @@
 
 
 namespace {
+    using day_14::Grid;
+
     template<std::ranges::random_access_range Range>
     auto shift(Range range) -> void {
         const auto is_rock = [](char symbol) { return symbol != '.'; };
@@ -39,42 +38,36 @@ namespace {
         }
     }
 
-    auto simulate(const std::vector<std::string_view>& grid, std::size_t count) -> std::vector<char> {
-        const auto row_count = grid.size();
-        const auto col_count = grid[0].size();
-
-        auto flatten_grid = std::vector<char>{};
-        flatten_grid.reserve(row_count * col_count);
-        std::ranges::copy(grid | std::views::join, std::back_inserter(flatten_grid));
-
+    auto simulate(Grid grid, std::size_t count) -> Grid {
         const auto make_spin = [&]() {
-            for (auto col = 0ul; col < col_count; ++col) {  // north
-                shift(flatten_grid | std::views::drop(col) | std::views::stride(col_count));
+            for (auto col = Grid::Index{0}; col < grid.cols(); ++col) {  // north
+                shift(grid.column(col));
             }
 
-            for (auto row : flatten_grid | std::views::chunk(col_count)) {  // west
-                shift(row);
+            for (auto row = Grid::Index{0}; row < grid.rows(); ++row) {  // west
+                shift(grid.row(row));
             }
 
-            for (auto col = 0ul; col < col_count; ++col) {  // south
-                shift(flatten_grid | std::views::drop(col) | std::views::stride(col_count) | std::views::reverse);
+            for (auto col = Grid::Index{0}; col < grid.cols(); ++col) {  // south
+                shift(grid.column(col) | std::views::reverse);
             }
 
-            for (auto row : flatten_grid | std::views::chunk(col_count)) {  // east
-                shift(row | std::views::reverse);
+            for (auto row = Grid::Index{0}; row < grid.rows(); ++row) {  // east
+                shift(grid.row(row) | std::views::reverse);
             }
         };
 
+        const auto snapshot = [&]() { return std::string{grid.cells().begin(), grid.cells().end()}; };
+
         auto visited = std::unordered_map<std::string, std::int64_t>{};
-        auto prev    = std::vector<char>{};
         auto ticks   = 0ll;
         auto done    = false;
         while (!done) {
-            visited.emplace(std::string{flatten_grid.begin(), flatten_grid.end()}, ticks);
+            visited.emplace(snapshot(), ticks);
             ticks++;
             make_spin();
 
-            const auto it = visited.find(std::string{flatten_grid.begin(), flatten_grid.end()});
+            const auto it = visited.find(snapshot());
             if (it != visited.end()) {
                 // iterate until a clean loop multiple
                 for (auto remaining = (count - ticks) % (ticks - it->second); remaining > 0; remaining--) {
@@ -84,22 +77,22 @@ namespace {
             }
         }
 
-        return flatten_grid;
+        return grid;
     }
 
-    auto find_total_load(const std::vector<std::string_view>& grid) -> std::uint64_t {
-        auto cubed_rock_positions = std::vector<std::int64_t>(grid[0].size(), -1);
-        auto rounded_rock_counts  = std::vector<std::size_t>(grid[0].size(), 0);
+    auto find_total_load(const Grid& grid) -> std::uint64_t {
+        auto cubed_rock_positions = std::vector<std::int64_t>(grid.cols(), -1);
+        auto rounded_rock_counts  = std::vector<std::size_t>(grid.cols(), 0);
 
         auto weight = 0ull;
-        for (auto row = 0u; row < grid.size(); row++) {
-            for (auto col = 0u; col < grid[row].size(); col++) {
-                if (grid[row][col] == 'O') {
+        for (auto row = Grid::Index{0}; row < grid.rows(); row++) {
+            for (auto col = Grid::Index{0}; col < grid.cols(); col++) {
+                if (grid[{row, col}] == 'O') {
                     rounded_rock_counts[col]++;
-                } else if (grid[row][col] == '#') {
+                } else if (grid[{row, col}] == '#') {
                     while (rounded_rock_counts[col] > 0) {
                         cubed_rock_positions[col]++;
-                        weight += std::ssize(grid) - cubed_rock_positions[col];
+                        weight += grid.rows() - cubed_rock_positions[col];
                         rounded_rock_counts[col]--;
                     }
                     cubed_rock_positions[col] = row;
@@ -110,7 +103,7 @@ namespace {
         for (auto col = 0ll; col < rounded_rock_counts.size(); col++) {
             while (rounded_rock_counts[col] > 0) {
                 cubed_rock_positions[col]++;
-                weight += std::ssize(grid) - cubed_rock_positions[col];
+                weight += grid.rows() - cubed_rock_positions[col];
                 rounded_rock_counts[col]--;
             }
         }
@@ -118,14 +111,12 @@ namespace {
         return weight;
     }
 
-    auto find_total_load(const std::vector<std::string_view>& grid, std::size_t simulations_count) -> std::uint64_t {
-        const auto row_count              = grid.size();
-        const auto col_count              = grid[0].size();
-        const auto simulated_flatten_grid = simulate(grid, simulations_count);
+    auto find_total_load(const Grid& grid, std::size_t simulations_count) -> std::uint64_t {
+        const auto simulated_grid = simulate(grid, simulations_count);
 
         auto weight = 0ull;
-        for (auto [idx, row] : simulated_flatten_grid | std::views::chunk(col_count) | std::views::enumerate) {
-            weight += std::ranges::count(row, 'O') * (row_count - idx);
+        for (auto row = Grid::Index{0}; row < simulated_grid.rows(); row++) {
+            weight += std::ranges::count(simulated_grid.row(row), 'O') * (simulated_grid.rows() - row);
         }
 
         return weight;
@@ -133,23 +124,21 @@ namespace {
 }  // namespace
 
 
-int main() {
-    const auto path = std::filesystem::path{"input.data"};
-    const auto map  = core::io::read_file(path, true);
-    const auto grid = core::strings::split(core::strings::strip(map), "\n");
+namespace day_14 {
+    auto parse(std::string_view input) -> Grid {
+        return Grid::parse(input);
+    }
 
-    const auto first_start_time = std::chrono::high_resolution_clock::now();
-    const auto total_load       = find_total_load(grid);
-    std::cout << std::format("The total load is {}\n", total_load);
-    const auto first_time_elapsed = std::chrono::high_resolution_clock::now() - first_start_time;
-    std::cout << std::format("Time elapsed {}\n", first_time_elapsed);
+    auto part_one(const Grid& grid) -> std::uint64_t {
+        return find_total_load(grid);
+    }
 
-    const auto second_start_time           = std::chrono::high_resolution_clock::now();
-    const auto simulations                 = 1'000'000'000ul;
-    const auto total_load_with_simulations = find_total_load(grid, simulations);
-    std::cout << std::format("The total load after {} simulations is {}\n", simulations, total_load_with_simulations);
-    const auto second_time_elapsed = std::chrono::high_resolution_clock::now() - second_start_time;
-    std::cout << std::format("Time elapsed {}\n", second_time_elapsed);
+    auto part_two(const Grid& grid, std::size_t simulations) -> std::uint64_t {
+        return find_total_load(grid, simulations);
+    }
 
-    return 0;
-}
+    auto solve(std::string_view input) -> core::Answers {
+        const auto grid = parse(input);
+        return {std::format("{}", part_one(grid)), std::format("{}", part_two(grid))};
+    }
+}  // namespace day_14
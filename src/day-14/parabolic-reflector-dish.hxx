@@ -0,0 +1,23 @@
+#ifndef PARABOLIC_REFLECTOR_DISH_HXX
+#define PARABOLIC_REFLECTOR_DISH_HXX
+
+#include <core/grid.hxx>
+#include <core/solution.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+
+namespace day_14 {
+    using Grid = core::Grid2D<char>;
+
+    constexpr auto SIMULATIONS = 1'000'000'000ul;
+
+    auto parse(std::string_view input) -> Grid;
+    auto part_one(const Grid& grid) -> std::uint64_t;
+    auto part_two(const Grid& grid, std::size_t simulations = SIMULATIONS) -> std::uint64_t;
+    auto solve(std::string_view input) -> core::Answers;
+}  // namespace day_14
+
+#endif  // PARABOLIC_REFLECTOR_DISH_HXX
@@ -1,15 +1,16 @@
+#include "lens-library.hxx"
+
+#include <core/arena.hxx>
 #include <core/io.hxx>
+#include <core/numbers.hxx>
 #include <core/strings.hxx>
 
-#include "core/numbers.hxx"
 #include <algorithm>
-#include <array>
 #include <cstddef>
-#include <filesystem>
 #include <format>
 #include <functional>
-#include <iostream>
 #include <list>
+#include <memory_resource>
 #include <ranges>
 #include <string>
 #include <string_view>
@@ -18,6 +19,9 @@
 
 
 namespace {
+    using day_15::Sequence;
+
+
     auto hash(std::string_view str) -> std::size_t {
         return std::ranges::fold_left(str, std::size_t{0}, [](std::size_t accumulated, char symbol) {
             constexpr auto magic_multiplier = 17ul;
@@ -32,10 +36,14 @@ namespace {
     public:
         static constexpr auto SIZE = 256;
 
-        using Bucket  = std::list<std::pair<std::string, std::size_t>>;
-        using Storage = std::array<Bucket, SIZE>;
+        using Bucket  = std::pmr::list<std::pair<std::pmr::string, std::size_t>>;
+        using Storage = std::pmr::vector<Bucket>;
 
     public:
+        // buckets, their nodes and labels are all allocated from `resource`
+        explicit HashMap(std::pmr::memory_resource* resource)
+            : storage_(SIZE, resource) {}
+
         auto pop(std::string_view label) -> void {
             storage_[hash(label)].remove_if([&](const auto& pair) { return pair.first == label; });
         }
@@ -46,7 +54,7 @@ namespace {
             if (it != storage_[key].end()) {
                 it->second = value;
             } else {
-                storage_[key].emplace_back(std::string{label}, value);
+                storage_[key].emplace_back(label, value);
             }
         }
 
@@ -64,34 +72,62 @@ namespace {
         Storage storage_;
     };
 
-    auto hash_sum(const std::vector<std::string_view>& instructions) -> std::size_t {
-        return std::ranges::fold_left(instructions | std::views::transform(hash), 0ul, std::plus<>{});
+    auto hash_sum(const Sequence& sequence) -> std::size_t {
+        return std::ranges::fold_left(sequence | std::views::transform(hash), 0ul, std::plus<>{});
     }
 
-    auto calc_focusing_power(const std::vector<std::string_view>& instructions) -> std::size_t {
-        HashMap hashmap;
-        for (const auto& instruction : instructions) {
-            const auto delimiter = instruction.find_first_of("=-");
-            const auto label     = instruction.substr(0, delimiter);
-            if (instruction[delimiter] == '=') {
-                const auto value = core::numbers::parse<std::size_t>(instruction.substr(delimiter + 1));
-                hashmap.push(label, value);
-            } else {
-                hashmap.pop(label);
-            }
+    auto apply(HashMap& hashmap, std::string_view instruction) -> void {
+        const auto delimiter = instruction.find_first_of("=-");
+        const auto label     = instruction.substr(0, delimiter);
+        if (instruction[delimiter] == '=') {
+            const auto value = core::numbers::parse<std::size_t>(instruction.substr(delimiter + 1));
+            hashmap.push(label, value);
+        } else {
+            hashmap.pop(label);
+        }
+    }
+
+    auto calc_focusing_power(const Sequence& sequence) -> std::size_t {
+        auto hashmap = HashMap{core::memory_resource()};
+        for (const auto instruction : sequence) {
+            apply(hashmap, instruction);
         }
         return hashmap.value();
     }
 }  // namespace
 
 
-int main() {
-    const auto path         = std::filesystem::path{"input.data"};
-    const auto data         = core::io::read_file(path, true);
-    const auto instructions = core::strings::split(core::strings::strip(data), ",");
+namespace day_15 {
+    auto parse(std::string_view input) -> Sequence {
+        return core::strings::split(core::strings::strip(input), ",");
+    }
 
-    std::cout << std::format("The sum of results is {}\n", hash_sum(instructions));
-    std::cout << std::format("The focusing power is {}\n", calc_focusing_power(instructions));
+    auto part_one(const Sequence& sequence) -> std::size_t {
+        return hash_sum(sequence);
+    }
+
+    auto part_two(const Sequence& sequence) -> std::size_t {
+        return calc_focusing_power(sequence);
+    }
+
+    auto solve(std::string_view input) -> core::Answers {
+        const auto sequence = parse(input);
+        return {std::format("{}", part_one(sequence)), std::format("{}", part_two(sequence))};
+    }
 
-    return 0;
-}
+    auto solve_stream(core::io::LineReader& input) -> core::Answers {
+        // the whole sequence is one line, so steps are split on commas; only the lenses in the boxes are kept
+        auto hashes  = std::size_t{0};
+        auto hashmap = HashMap{core::memory_resource()};
+        while (const auto step = input.next(',')) {
+            const auto instruction = core::strings::strip(*step);
+            if (instruction.empty()) {
+                continue;
+            }
+
+            hashes += hash(instruction);
+            apply(hashmap, instruction);
+        }
+        return {std::format("{}", hashes), std::format("{}", hashmap.value())};
+    }
+}  // namespace day_15
@@ -0,0 +1,22 @@
+#ifndef LENS_LIBRARY_HXX
+#define LENS_LIBRARY_HXX
+
+#include <core/solution.hxx>
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+
+namespace day_15 {
+    // the steps are views into the parsed input, so it must outlive the sequence
+    using Sequence = std::vector<std::string_view>;
+
+    auto parse(std::string_view input) -> Sequence;
+    auto part_one(const Sequence& sequence) -> std::size_t;
+    auto part_two(const Sequence& sequence) -> std::size_t;
+    auto solve(std::string_view input) -> core::Answers;
+    auto solve_stream(core::io::LineReader& input) -> core::Answers;
+}  // namespace day_15
+
+#endif  // LENS_LIBRARY_HXX
@@ -0,0 +1,19 @@
+#include "lens-library.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto path     = std::filesystem::path{"input.data"};
+    const auto data     = core::io::MappedFile{path};
+    const auto sequence = day_15::parse(data.view());
+
+    std::cout << std::format("The sum of results is {}\n", day_15::part_one(sequence));
+    std::cout << std::format("The focusing power is {}\n", day_15::part_two(sequence));
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+#include "the-floor-will-be-lava.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto path = std::filesystem::path{"input.data"};
+    const auto data = core::io::MappedFile{path};
+    const auto map  = day_16::parse(data.view());
+
+    std::cout << std::format("The number of energized tiles is : {}\n", day_16::part_one(map));
+    std::cout << std::format("The number of energized tiles with sides is : {}\n", day_16::part_two(map));
+
+    return 0;
+}
@@ -1,101 +1,66 @@
-#include <core/io.hxx>
-#include <core/strings.hxx>
+#include "the-floor-will-be-lava.hxx"
+
+#include <core/arena.hxx>
+#include <core/bit-grid.hxx>
+#include <core/coordinate.hxx>
+#include <core/grid.hxx>
+#include <core/profile.hxx>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <filesystem>
 #include <format>
-#include <functional>
-#include <iostream>
-#include <queue>
+#include <span>
 #include <string_view>
-#include <unordered_set>
-#include <vector>
+#include <utility>
 
 
 namespace {
-    using Grid = std::vector<std::string_view>;
-
-    struct Coordinate {
-        std::int64_t row = 0;
-        std::int64_t col = 0;
-
-        auto operator<=>(const Coordinate& other) const = default;
+    using day_16::Grid;
+    using Coordinate = core::Coordinate;
 
-        [[nodiscard]] Coordinate operator+(const Coordinate& other) const {
-            return Coordinate{
-                .row = row + other.row,
-                .col = col + other.col,
-            };
-        }
-    };
+    // the map is surrounded by these, a beam that reaches one has left the contraption
+    constexpr auto OUTSIDE = ' ';
 
     struct Beam {
         Coordinate position;
         Coordinate direction;
         auto       operator<=>(const Beam&) const = default;
     };
-}  // namespace
 
-template<>
-struct std::hash<Coordinate> {
-    auto operator()(const Coordinate& coordinate) const noexcept -> std::size_t {
-        const auto first  = std::hash<std::int64_t>{}(coordinate.row);
-        const auto second = std::hash<std::int64_t>{}(coordinate.col);
-        return first ^ (second << 1);
-    }
-};
-
-template<>
-struct std::hash<Beam> {
-    auto operator()(const Beam& beam) const noexcept -> std::size_t {
-        const auto first  = std::hash<Coordinate>{}(beam.position);
-        const auto second = std::hash<Coordinate>{}(beam.direction);
-        return first ^ (second << 1);
+    // index of a unit step among the four headings, for the per-heading visited grids
+    auto heading(Coordinate direction) -> std::size_t {
+        if (direction.row != 0) {
+            return direction.row < 0 ? 0 : 1;
+        }
+        return direction.col < 0 ? 2 : 3;
     }
-};
 
-namespace {
     auto energized_tiles(const Grid& grid, Coordinate start_pos, Coordinate start_dir) -> std::int64_t {
-        auto queue     = std::queue<Beam>{};
-        auto visited   = std::unordered_set<Beam>{};
-        auto energized = std::unordered_set<Coordinate>{};
-
-        const auto can_head_next = [&](const Beam& beam) {
-            if (beam.position.row < 0 || beam.position.col < 0) {
-                return false;
-            }
+        CORE_PROFILE_ZONE("day-16/beam-bfs");
 
-            if (beam.position.row >= std::ssize(grid)) {
-                return false;
-            }
-
-            if (beam.position.col >= std::ssize(grid[0])) {
-                return false;
-            }
-
-            return not visited.contains(beam);
-        };
+        // one bit per tile and heading, the energized tiles are their union
+        auto queue   = core::Queue<Beam>{core::memory_resource()};
+        auto visited = std::array<core::BitGrid, 4>{};
+        visited.fill(core::BitGrid{grid.rows(), grid.cols()});
 
         const auto continue_ray = [&](Coordinate pos, Coordinate dir) {
             pos = pos + dir;
-            if (can_head_next({pos, dir})) {
-                visited.emplace(pos, dir);
+            if (grid[pos] != OUTSIDE and visited[heading(dir)].insert(pos)) {
                 queue.emplace(pos, dir);
-                energized.emplace(pos);
             }
         };
 
         // prepare for the old good one BFS
         queue.emplace(start_pos, start_dir);
-        visited.emplace(start_pos, start_dir);
-        energized.emplace(start_pos);
+        visited[heading(start_dir)].set(start_pos);
         while (not queue.empty()) {
             const auto [pos, dir] = queue.front();
             queue.pop();
+            CORE_PROFILE_COUNT("day-16/beams", 1);
 
-            switch (grid[pos.row][pos.col]) {
+            switch (grid[pos]) {
                 case '.': {  // just continue
                     continue_ray(pos, dir);
                     break;
@@ -133,32 +98,36 @@ namespace {
             }
         }
 
-        return std::ssize(energized);
+        auto energized = std::move(visited[0]);
+        for (const auto& beams : std::span{visited}.subspan(1)) {
+            energized |= beams;
+        }
+        return static_cast<std::int64_t>(energized.count());
     }
 
     auto energize_tiles_with_sides(const Grid& grid) -> std::int64_t {
-        auto max_result = 0ll;
+        auto max_result = std::int64_t{0};
 
-        const auto grid_rows = std::ssize(grid);
-        const auto grid_cols = std::ssize(grid[0]);
+        const auto grid_rows = grid.rows();
+        const auto grid_cols = grid.cols();
 
         // handle top row (downward)
-        for (auto col = 0ll; col < grid_cols; col++) {
+        for (auto col = Grid::Index{0}; col < grid_cols; col++) {
             max_result = std::max(max_result, energized_tiles(grid, {0, col}, {1, 0}));
         }
 
         // handle bottom row (upward)
-        for (auto col = 0ll; col < grid_cols; col++) {
+        for (auto col = Grid::Index{0}; col < grid_cols; col++) {
             max_result = std::max(max_result, energized_tiles(grid, {grid_rows - 1, col}, {-1, 0}));
         }
 
         // handle left column (rightward)
-        for (auto row = 0ll; row < grid_rows; row++) {
+        for (auto row = Grid::Index{0}; row < grid_rows; row++) {
             max_result = std::max(max_result, energized_tiles(grid, {row, 0}, {0, 1}));
         }
 
         // handle right column (leftward)
-        for (auto row = 0ll; row < grid_rows; row++) {
+        for (auto row = Grid::Index{0}; row < grid_rows; row++) {
             max_result = std::max(max_result, energized_tiles(grid, {row, grid_cols - 1}, {0, -1}));
         }
 
@@ -167,13 +136,21 @@ namespace {
 }  // namespace
 
 
-int main() {
-    const auto path = std::filesystem::path{"input.data"};
-    const auto data = core::io::read_file(path, true);
-    const auto map  = core::strings::split(core::strings::strip(data), "\n");
+namespace day_16 {
+    auto parse(std::string_view input) -> Grid {
+        return Grid::parse(input, 1, OUTSIDE);
+    }
 
-    std::cout << std::format("The number of energized tiles is : {}\n", energized_tiles(map, {0, 0}, {0, 1}));
-    std::cout << std::format("The number of energized tiles with sides is : {}\n", energize_tiles_with_sides(map));
+    auto part_one(const Grid& map) -> std::int64_t {
+        return energized_tiles(map, {0, 0}, {0, 1});
+    }
 
-    return 0;
-}
+    auto part_two(const Grid& map) -> std::int64_t {
+        return energize_tiles_with_sides(map);
+    }
+
+    auto solve(std::string_view input) -> core::Answers {
+        const auto map = parse(input);
+        return {std::format("{}", part_one(map)), std::format("{}", part_two(map))};
+    }
+}  // namespace day_16
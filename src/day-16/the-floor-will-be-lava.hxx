@@ -0,0 +1,20 @@
+#ifndef THE_FLOOR_WILL_BE_LAVA_HXX
+#define THE_FLOOR_WILL_BE_LAVA_HXX
+
+#include <core/grid.hxx>
+#include <core/solution.hxx>
+
+#include <cstdint>
+#include <string_view>
+
+
+namespace day_16 {
+    using Grid = core::Grid2D<char>;
+
+    auto parse(std::string_view input) -> Grid;
+    auto part_one(const Grid& map) -> std::int64_t;
+    auto part_two(const Grid& map) -> std::int64_t;
+    auto solve(std::string_view input) -> core::Answers;
+}  // namespace day_16
+
+#endif  // THE_FLOOR_WILL_BE_LAVA_HXX
@@ -1,56 +1,82 @@
-#include <core/io.hxx>
-#include <core/strings.hxx>
+#include "clumsy-crucible.hxx"
+
+#include <core/bucket-queue.hxx>
+#include <core/coordinate.hxx>
+#include <core/grid.hxx>
+#include <core/profile.hxx>
 
 #include <array>
 #include <cstddef>
 #include <cstdint>
-#include <filesystem>
 #include <format>
-#include <iostream>
 #include <limits>
 #include <queue>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 
 namespace {
-    using Grid = std::vector<std::string_view>;
+    using day_17::Grid;
+    using Coordinate = core::Coordinate;
 
-    struct Coordinate {
-        std::int64_t row = 0;
-        std::int64_t col = 0;
+    // heat loss of the cells around the map, no block inside of it is that cheap
+    constexpr auto OUTSIDE = std::uint8_t{0};
 
-        auto operator<=>(const Coordinate& other) const = default;
+    // a block loses a single digit of heat, so the queue only ever spans ten distinct keys
+    constexpr auto MAX_BLOCK_HEAT_LOSS = 9u;
 
-        [[nodiscard]] Coordinate operator+(const Coordinate& other) const {
-            return Coordinate{
-                .row = row + other.row,
-                .col = col + other.col,
-            };
-        }
+    constexpr auto MAX_LINE_LENGTH_DEFAULT       = 3;
+    constexpr auto MAX_ULTRA_LINE_LENGTH_DEFAULT = 10;
+    constexpr auto DIR_COUNT                     = 4;
 
-        [[nodiscard]] Coordinate operator*(std::int64_t scalar) const {
-            return Coordinate{
-                .row = row * scalar,
-                .col = col * scalar,
-            };
-        }
-    };
+    // ordered as `to_index` numbers them
+    constexpr auto DIRECTIONS = std::array<Coordinate, DIR_COUNT>{{{-1, 0}, {1, 0}, {0, -1}, {0, 1}}};
 
+    // the heat loss so far is the queue key
     struct State {
         Coordinate   position;
-        Coordinate   direction;
-        std::int64_t steps     = 0;
-        std::int64_t heat_loss = 0;
+        std::uint8_t heading = 0;  // index into DIRECTIONS
+        std::uint8_t steps   = 0;
+    };
+
+    using Buckets = core::BucketQueue<State>;
 
-        auto operator<(const State& other) const noexcept {
-            return heat_loss > other.heat_loss;  // priority queue favors lower heat_loss
+    // std::priority_queue behind the interface of the bucket queue
+    class BinaryHeap {
+    public:
+        using Key = Buckets::Key;
+
+    public:
+        explicit BinaryHeap(Key /*max_weight*/) {}
+
+        [[nodiscard]] auto empty() const -> bool {
+            return heap_.empty();
         }
-    };
 
-    constexpr auto MAX_LINE_LENGTH_DEFAULT       = 3;
-    constexpr auto MAX_ULTRA_LINE_LENGTH_DEFAULT = 10;
-    constexpr auto DIR_COUNT                     = 4;
+        [[nodiscard]] auto size() const -> std::size_t {
+            return heap_.size();
+        }
+
+        auto push(Key key, State state) -> void {
+            heap_.emplace(key, state);
+        }
+
+        auto pop() -> std::pair<Key, State> {
+            auto entry = heap_.top();
+            heap_.pop();
+            return entry;
+        }
+
+    private:
+        struct Later {
+            auto operator()(const std::pair<Key, State>& lhs, const std::pair<Key, State>& rhs) const -> bool {
+                return lhs.first > rhs.first;
+            }
+        };
+
+        std::priority_queue<std::pair<Key, State>, std::vector<std::pair<Key, State>>, Later> heap_;
+    };
 
     template<std::size_t LINE_LENGTH>
     using Line = std::array<std::int64_t, LINE_LENGTH + 1>;
@@ -81,7 +107,7 @@ namespace {
         return Coordinate{direction.col, 0};
     };
 
-    auto to_index(Coordinate direction) -> std::size_t {
+    auto to_index(Coordinate direction) -> std::uint8_t {
         if (direction.row == -1) {
             return 0;
         }
@@ -97,137 +123,130 @@ namespace {
         return 3;
     };
 
+    template<typename Queue>
     auto find_minimum_heat_loss(const Grid& grid) -> std::size_t {
-        const auto is_valid_position = [&](const Coordinate& pos) {
-            return pos.row >= 0 && pos.col >= 0 && pos.row < std::ssize(grid) && pos.col < std::ssize(grid[0]);
-        };
+        CORE_PROFILE_ZONE("day-17/dijkstra");
 
-        const auto get_heat_loss = [&](const Coordinate& pos) { return grid[pos.row][pos.col] - '0'; };
+        const auto is_valid_position = [&](const Coordinate& pos) { return grid[pos] != OUTSIDE; };
+
+        const auto get_heat_loss = [&](const Coordinate& pos) { return grid[pos]; };
 
         // Dijkstra's algorithm setup
-        auto lines = std::vector(
-            grid.size(), std::vector(grid[0].size(), make_array<DIR_COUNT>(make_empty_line<MAX_LINE_LENGTH_DEFAULT>()))
-        );
-        auto queue = std::priority_queue<State>{};
+        auto lines = std::vector(grid.cells().size(), make_array<DIR_COUNT>(make_empty_line<MAX_LINE_LENGTH_DEFAULT>()));
+        auto queue = Queue{MAX_BLOCK_HEAT_LOSS};
 
         // Initialize with starting states (down and right)
-        queue.push(State{{0, 0}, {0, 1}, 0, 0});
-        queue.push(State{{0, 0}, {1, 0}, 0, 0});
+        queue.push(0, State{{0, 0}, to_index({0, 1}), 0});
+        queue.push(0, State{{0, 0}, to_index({1, 0}), 0});
 
-        const auto destination = Coordinate{.row = std::ssize(grid) - 1, .col = std::ssize(grid[0]) - 1};
+        const auto destination = Coordinate{.row = grid.rows() - 1, .col = grid.cols() - 1};
         while (!queue.empty()) {
-            auto [pos, dir, steps, heat_loss] = queue.top();
+            const auto [heat_loss, state] = queue.pop();
+            const auto [pos, heading, steps] = state;
             if (pos == destination) {
                 return heat_loss;
             }
-            queue.pop();
+            CORE_PROFILE_COUNT("day-17/pops", 1);
+            CORE_PROFILE_GAUGE("day-17/queue", queue.size());
 
-            auto& current_heat_loss = lines[pos.row][pos.col][to_index(dir)][steps];
-            if (current_heat_loss <= heat_loss) {
+            const auto dir               = DIRECTIONS[heading];
+            auto&      current_heat_loss = lines[grid.index(pos)][heading][steps];
+            if (current_heat_loss <= static_cast<std::int64_t>(heat_loss)) {
                 continue;  // Skip worse states
             }
 
-            current_heat_loss = heat_loss;
+            current_heat_loss = static_cast<std::int64_t>(heat_loss);
 
             // continue in the same direction
             if (steps + 1 <= MAX_LINE_LENGTH_DEFAULT && is_valid_position(pos + dir)) {
-                queue.push({
-                    .position  = pos + dir,
-                    .direction = dir,
-                    .steps     = steps + 1,
-                    .heat_loss = heat_loss + get_heat_loss(pos + dir),
-                });
+                queue.push(
+                    heat_loss + get_heat_loss(pos + dir),
+                    {.position = pos + dir, .heading = heading, .steps = static_cast<std::uint8_t>(steps + 1)}
+                );
             }
 
             // turn left
             const auto left_dir = left_direction(dir);
             if (is_valid_position(pos + left_dir)) {
-                queue.push({
-                    .position  = pos + left_dir,
-                    .direction = left_dir,
-                    .steps     = 1,
-                    .heat_loss = heat_loss + get_heat_loss(pos + left_dir),
-                });
+                queue.push(
+                    heat_loss + get_heat_loss(pos + left_dir),
+                    {.position = pos + left_dir, .heading = to_index(left_dir), .steps = 1}
+                );
             }
 
             // turn right
             const auto right_dir = right_direction(dir);
             if (is_valid_position(pos + right_dir)) {
-                queue.push({
-                    .position  = pos + right_dir,
-                    .direction = right_dir,
-                    .steps     = 1,
-                    .heat_loss = heat_loss + get_heat_loss(pos + right_dir),
-                });
+                queue.push(
+                    heat_loss + get_heat_loss(pos + right_dir),
+                    {.position = pos + right_dir, .heading = to_index(right_dir), .steps = 1}
+                );
             }
         }
 
         return -1;  // No valid path found
     }
 
+    template<typename Queue>
     auto find_minimum_heat_loss_with_ultra(const Grid& grid) -> std::size_t {
-        const auto is_valid_position = [&](const Coordinate& pos) {
-            return pos.row >= 0 && pos.col >= 0 && pos.row < std::ssize(grid) && pos.col < std::ssize(grid[0]);
-        };
+        CORE_PROFILE_ZONE("day-17/dijkstra-ultra");
 
-        const auto get_heat_loss = [&](const Coordinate& pos) { return grid[pos.row][pos.col] - '0'; };
+        const auto is_valid_position = [&](const Coordinate& pos) { return grid[pos] != OUTSIDE; };
+
+        const auto get_heat_loss = [&](const Coordinate& pos) { return grid[pos]; };
 
         // Dijkstra's algorithm setup
-        auto lines = std::vector(
-            grid.size(), std::vector(grid[0].size(), make_array<DIR_COUNT>(make_empty_line<MAX_ULTRA_LINE_LENGTH_DEFAULT>()))
-        );
-        auto queue = std::priority_queue<State>{};
+        auto lines =
+            std::vector(grid.cells().size(), make_array<DIR_COUNT>(make_empty_line<MAX_ULTRA_LINE_LENGTH_DEFAULT>()));
+        auto queue = Queue{MAX_BLOCK_HEAT_LOSS};
 
         // Initialize with starting states (down and right)
-        queue.push(State{{0, 0}, {0, 1}, 0, 0});
-        queue.push(State{{0, 0}, {1, 0}, 0, 0});
+        queue.push(0, State{{0, 0}, to_index({0, 1}), 0});
+        queue.push(0, State{{0, 0}, to_index({1, 0}), 0});
 
-        const auto destination = Coordinate{.row = std::ssize(grid) - 1, .col = std::ssize(grid[0]) - 1};
+        const auto destination = Coordinate{.row = grid.rows() - 1, .col = grid.cols() - 1};
         while (!queue.empty()) {
-            auto [pos, dir, steps, heat_loss] = queue.top();
+            const auto [heat_loss, state] = queue.pop();
+            const auto [pos, heading, steps] = state;
             if (pos == destination) {
                 return heat_loss;
             }
-            queue.pop();
+            CORE_PROFILE_COUNT("day-17/pops", 1);
+            CORE_PROFILE_GAUGE("day-17/queue", queue.size());
 
-            auto& current_heat_loss = lines[pos.row][pos.col][to_index(dir)][steps];
-            if (current_heat_loss <= heat_loss) {
+            const auto dir               = DIRECTIONS[heading];
+            auto&      current_heat_loss = lines[grid.index(pos)][heading][steps];
+            if (current_heat_loss <= static_cast<std::int64_t>(heat_loss)) {
                 continue;  // Skip worse states
             }
 
-            current_heat_loss = heat_loss;
+            current_heat_loss = static_cast<std::int64_t>(heat_loss);
 
             // continue in the same direction
             if (steps + 1 <= MAX_ULTRA_LINE_LENGTH_DEFAULT && is_valid_position(pos + dir)) {
-                queue.push({
-                    .position  = pos + dir,
-                    .direction = dir,
-                    .steps     = steps + 1,
-                    .heat_loss = heat_loss + get_heat_loss(pos + dir),
-                });
+                queue.push(
+                    heat_loss + get_heat_loss(pos + dir),
+                    {.position = pos + dir, .heading = heading, .steps = static_cast<std::uint8_t>(steps + 1)}
+                );
             }
 
             if (steps >= 4) {
                 // turn left
                 const auto left_dir = left_direction(dir);
-                if (is_valid_position(pos + left_dir * 4)) {
-                    queue.push({
-                        .position  = pos + left_dir,
-                        .direction = left_dir,
-                        .steps     = 1,
-                        .heat_loss = heat_loss + get_heat_loss(pos + left_dir),
-                    });
+                if (grid.contains(pos + left_dir * 4)) {
+                    queue.push(
+                        heat_loss + get_heat_loss(pos + left_dir),
+                        {.position = pos + left_dir, .heading = to_index(left_dir), .steps = 1}
+                    );
                 }
 
                 // turn right
                 const auto right_dir = right_direction(dir);
-                if (is_valid_position(pos + right_dir * 4)) {
-                    queue.push({
-                        .position  = pos + right_dir,
-                        .direction = right_dir,
-                        .steps     = 1,
-                        .heat_loss = heat_loss + get_heat_loss(pos + right_dir),
-                    });
+                if (grid.contains(pos + right_dir * 4)) {
+                    queue.push(
+                        heat_loss + get_heat_loss(pos + right_dir),
+                        {.position = pos + right_dir, .heading = to_index(right_dir), .steps = 1}
+                    );
                 }
             }
         }
@@ -237,13 +256,22 @@ namespace {
 }  // namespace
 
 
-int main() {
-    const auto path = std::filesystem::path{"input.data"};
-    const auto data = core::io::read_file(path, true);
-    const auto map  = core::strings::split(core::strings::strip(data), "\n");
+namespace day_17 {
+    auto parse(std::string_view input) -> Grid {
+        return Grid::parse(input, 1, OUTSIDE, [](char digit) -> std::uint8_t { return digit - '0'; });
+    }
+
+    auto part_one(const Grid& map, Queue queue) -> std::int64_t {
+        return (queue == Queue::BUCKETS) ? find_minimum_heat_loss<Buckets>(map) : find_minimum_heat_loss<BinaryHeap>(map);
+    }
 
-    std::cout << std::format("The least heat loss is: {}\n", find_minimum_heat_loss(map));
-    std::cout << std::format("The least heat loss with ultra crucible is: {}\n", find_minimum_heat_loss_with_ultra(map));
+    auto part_two(const Grid& map, Queue queue) -> std::int64_t {
+        return (queue == Queue::BUCKETS) ? find_minimum_heat_loss_with_ultra<Buckets>(map)
+                                         : find_minimum_heat_loss_with_ultra<BinaryHeap>(map);
+    }
 
-    return 0;
-}
+    auto solve(std::string_view input) -> core::Answers {
+        const auto map = parse(input);
+        return {std::format("{}", part_one(map)), std::format("{}", part_two(map))};
+    }
+}  // namespace day_17
@@ -0,0 +1,26 @@
+#ifndef CLUMSY_CRUCIBLE_HXX
+#define CLUMSY_CRUCIBLE_HXX
+
+#include <core/grid.hxx>
+#include <core/solution.hxx>
+
+#include <cstdint>
+#include <string_view>
+
+
+namespace day_17 {
+    using Grid = core::Grid2D<std::uint8_t>;
+
+    // what the searches queue their states on, the binary heap is kept to measure the buckets against
+    enum class Queue : std::uint8_t {
+        BUCKETS,
+        BINARY_HEAP,
+    };
+
+    auto parse(std::string_view input) -> Grid;
+    auto part_one(const Grid& map, Queue queue = Queue::BUCKETS) -> std::int64_t;
+    auto part_two(const Grid& map, Queue queue = Queue::BUCKETS) -> std::int64_t;
+    auto solve(std::string_view input) -> core::Answers;
+}  // namespace day_17
+
+#endif  // CLUMSY_CRUCIBLE_HXX
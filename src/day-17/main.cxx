@@ -0,0 +1,19 @@
+#include "clumsy-crucible.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto path = std::filesystem::path{"input.data"};
+    const auto data = core::io::MappedFile{path};
+    const auto map  = day_17::parse(data.view());
+
+    std::cout << std::format("The least heat loss is: {}\n", day_17::part_one(map));
+    std::cout << std::format("The least heat loss with ultra crucible is: {}\n", day_17::part_two(map));
+
+    return 0;
+}
@@ -1,101 +1,36 @@
+#include "lavaduct-lagoon.hxx"
+
+#include <core/coordinate.hxx>
+#include <core/flat-hash.hxx>
 #include <core/io.hxx>
 #include <core/numbers.hxx>
+#include <core/profile.hxx>
 
 #include <algorithm>
 #include <array>
 #include <cctype>
 #include <cstddef>
 #include <cstdint>
-#include <filesystem>
 #include <format>
-#include <fstream>
 #include <functional>
-#include <iostream>
+#include <istream>
 #include <iterator>
 #include <limits>
 #include <queue>
 #include <ranges>
 #include <set>
+#include <spanstream>
 #include <string>
-#include <unordered_set>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 
 namespace {
-    struct Coordinate {
-        std::int64_t row = 0;
-        std::int64_t col = 0;
-
-        auto operator<=>(const Coordinate& other) const = default;
-
-        [[nodiscard]] Coordinate operator+(const Coordinate& other) const {
-            return Coordinate{
-                .row = row + other.row,
-                .col = col + other.col,
-            };
-        }
-
-        [[nodiscard]] Coordinate operator*(std::int64_t scalar) const {
-            return Coordinate{
-                .row = row * scalar,
-                .col = col * scalar,
-            };
-        }
-    };
-
-    struct BuggedInstruction {
-        Coordinate   direction;
-        std::int64_t distance = 0;
-        std::string  color;
-
-        friend auto operator>>(std::istream& stream, BuggedInstruction& instruction) -> std::istream& {
-            while (std::isspace(stream.peek()) != 0) {
-                stream.ignore();
-            }
-
-            switch (stream.get()) {
-                case 'U': instruction.direction = {-1, 0}; break;
-                case 'D': instruction.direction = {1, 0}; break;
-                case 'L': instruction.direction = {0, -1}; break;
-                case 'R': instruction.direction = {0, 1}; break;
-            }
-
-            instruction.distance = core::io::read<std::int64_t>(stream);
-            instruction.color    = core::io::read<std::string>(stream);
-
-            return stream;
-        }
-    };
-
-    struct Instruction {
-        Coordinate   dig;
-        std::int64_t distance = 0;
-
-        friend auto operator>>(std::istream& stream, Instruction& instr) -> std::istream& {
-            // skip bugged part
-            core::io::read<std::string>(stream);
-            core::io::read<std::string>(stream);
-            if (not stream) {
-                return stream;
-            }
-
-            const auto instruction     = core::io::read<std::string>(stream);
-            const auto direction_index = 7ul;
-            switch (instruction[direction_index]) {
-                case '0': instr.dig = {0, 1}; break;
-                case '1': instr.dig = {1, 0}; break;
-                case '2': instr.dig = {0, -1}; break;
-                case '3': instr.dig = {-1, 0}; break;
-            }
-
-            const auto distance_length  = 5;
-            const auto encoded_distance = std::string_view{instruction.data() + 2, distance_length};
-            instr.distance              = core::numbers::parse_hex<std::int64_t>(encoded_distance);
-
-            return stream;
-        }
-    };
+    using Coordinate = core::Coordinate;
+    using day_18::BuggedInstruction;
+    using day_18::DigPlan;
+    using day_18::Instruction;
 
     struct Wall {
         Coordinate top_left;
@@ -131,17 +66,8 @@ namespace {
     };
 }  // namespace
 
-template<>
-struct std::hash<Coordinate> {
-    auto operator()(const Coordinate& coordinate) const noexcept -> std::size_t {
-        const auto first  = std::hash<std::int64_t>{}(coordinate.row);
-        const auto second = std::hash<std::int64_t>{}(coordinate.col);
-        return first ^ (second << 1);
-    }
-};
-
 namespace {
-    using CoordinateSet   = std::unordered_set<Coordinate>;
+    using CoordinateSet   = core::FlatHashSet<Coordinate>;
     using CoordinateQueue = std::queue<Coordinate>;
 
     const auto DIRECTIONS = std::array{
@@ -151,16 +77,6 @@ namespace {
         Coordinate{0, 1},   // right
     };
 
-    auto load_bugged_instructions(const std::filesystem::path& path) -> std::vector<BuggedInstruction> {
-        auto stream = std::ifstream{path};
-        return core::io::read_sequence<BuggedInstruction>(stream);
-    }
-
-    auto load_fixed_instructions(const std::filesystem::path& path) -> std::vector<Instruction> {
-        auto stream = std::ifstream{path};
-        return core::io::read_sequence<Instruction>(stream);
-    }
-
     auto expand_bounding_box(Coordinate& top_left, Coordinate& bottom_right) {
         top_left.row--;
         top_left.col--;
@@ -188,6 +104,7 @@ namespace {
         expand_bounding_box(top_left, bottom_right);
 
         // BFS again (^_^)
+        CORE_PROFILE_ZONE("day-18/flood-fill");
         auto outside = CoordinateSet{};
         auto queue   = CoordinateQueue{};
         queue.push(top_left);
@@ -201,6 +118,7 @@ namespace {
         while (!queue.empty()) {
             current = queue.front();
             queue.pop();
+            CORE_PROFILE_COUNT("day-18/outside", 1);
 
             for (const auto& dir : DIRECTIONS) {
                 if (const auto next = current + dir; can_step(next)) {
@@ -260,7 +178,7 @@ namespace {
                 } else if (line_count % 2 == 1) {
                     // If we have odd number of lines to the left, we can calculate the
                     // number of spaces from the previous line to the left
-                    inside_spaces += std::max(it->top_left.col - prev.bottom_right.col - 1, 0ll);
+                    inside_spaces += std::max(it->top_left.col - prev.bottom_right.col - 1, std::int64_t{0});
                 }
 
                 line_count++;
@@ -298,13 +216,70 @@ namespace {
     }
 }  // namespace
 
-int main() {
-    const auto path                = std::filesystem::path{"input.data"};
-    const auto bugged_instructions = load_bugged_instructions(path);
-    const auto fixed_instructions  = load_fixed_instructions(path);
 
-    std::cout << std::format("The volume of lava is: {}\n", lagoon_size(bugged_instructions));
-    std::cout << std::format("The volume of lava is: {}\n", big_lagoon_size(fixed_instructions));
+namespace day_18 {
+    auto operator>>(std::istream& stream, BuggedInstruction& instruction) -> std::istream& {
+        while (std::isspace(stream.peek()) != 0) {
+            stream.ignore();
+        }
+
+        switch (stream.get()) {
+            case 'U': instruction.direction = {-1, 0}; break;
+            case 'D': instruction.direction = {1, 0}; break;
+            case 'L': instruction.direction = {0, -1}; break;
+            case 'R': instruction.direction = {0, 1}; break;
+        }
+
+        instruction.distance = core::io::read<std::int64_t>(stream);
+        instruction.color    = core::io::read<std::string>(stream);
+
+        return stream;
+    }
+
+    auto operator>>(std::istream& stream, Instruction& instr) -> std::istream& {
+        // skip bugged part
+        core::io::read<std::string>(stream);
+        core::io::read<std::string>(stream);
+        if (not stream) {
+            return stream;
+        }
 
-    return 0;
-}
+        const auto instruction     = core::io::read<std::string>(stream);
+        const auto direction_index = 7ul;
+        switch (instruction[direction_index]) {
+            case '0': instr.dig = {0, 1}; break;
+            case '1': instr.dig = {1, 0}; break;
+            case '2': instr.dig = {0, -1}; break;
+            case '3': instr.dig = {-1, 0}; break;
+        }
+
+        const auto distance_length  = 5;
+        const auto encoded_distance = std::string_view{instruction.data() + 2, distance_length};
+        instr.distance              = core::numbers::parse_hex<std::int64_t>(encoded_distance);
+
+        return stream;
+    }
+
+    auto parse(std::string_view input) -> DigPlan {
+        auto bugged_stream = std::ispanstream{input};
+        auto fixed_stream  = std::ispanstream{input};
+
+        return {
+            .bugged = core::io::read_sequence<BuggedInstruction>(bugged_stream),
+            .fixed  = core::io::read_sequence<Instruction>(fixed_stream),
+        };
+    }
+
+    auto part_one(const DigPlan& plan) -> std::int64_t {
+        return lagoon_size(plan.bugged);
+    }
+
+    auto part_two(const DigPlan& plan) -> std::int64_t {
+        return big_lagoon_size(plan.fixed);
+    }
+
+    auto solve(std::string_view input) -> core::Answers {
+        const auto plan = parse(input);
+        return {std::format("{}", part_one(plan)), std::format("{}", part_two(plan))};
+    }
+}  // namespace day_18
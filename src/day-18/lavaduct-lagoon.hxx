@@ -0,0 +1,41 @@
+#ifndef LAVADUCT_LAGOON_HXX
+#define LAVADUCT_LAGOON_HXX
+
+#include <core/coordinate.hxx>
+#include <core/solution.hxx>
+
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace day_18 {
+    struct BuggedInstruction {
+        core::Coordinate direction;
+        std::int64_t     distance = 0;
+        std::string      color;
+
+        friend auto operator>>(std::istream& stream, BuggedInstruction& instruction) -> std::istream&;
+    };
+
+    struct Instruction {
+        core::Coordinate dig;
+        std::int64_t     distance = 0;
+
+        friend auto operator>>(std::istream& stream, Instruction& instr) -> std::istream&;
+    };
+
+    struct DigPlan {
+        std::vector<BuggedInstruction> bugged;
+        std::vector<Instruction>       fixed;
+    };
+
+    auto parse(std::string_view input) -> DigPlan;
+    auto part_one(const DigPlan& plan) -> std::int64_t;
+    auto part_two(const DigPlan& plan) -> std::int64_t;
+    auto solve(std::string_view input) -> core::Answers;
+}  // namespace day_18
+
+#endif  // LAVADUCT_LAGOON_HXX
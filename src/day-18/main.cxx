@@ -0,0 +1,19 @@
+#include "lavaduct-lagoon.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto path = std::filesystem::path{"input.data"};
+    const auto data = core::io::MappedFile{path};
+    const auto plan = day_18::parse(data.view());
+
+    std::cout << std::format("The volume of lava is: {}\n", day_18::part_one(plan));
+    std::cout << std::format("The volume of lava is: {}\n", day_18::part_two(plan));
+
+    return 0;
+}
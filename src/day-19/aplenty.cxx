@@ -1,130 +1,166 @@
-#include <core/io.hxx>
+#include "aplenty.hxx"
+
+#include <core/cache.hxx>
+#include <core/record.hxx>
+#include <core/strings.hxx>
 
 #include <algorithm>
-#include <cctype>
+#include <cstddef>
 #include <cstdint>
-#include <filesystem>
 #include <format>
-#include <fstream>
 #include <functional>
-#include <iostream>
-#include <istream>
 #include <iterator>
-#include <ranges>
-#include <string>
+#include <span>
+#include <stdexcept>
 #include <string_view>
-#include <unordered_map>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 
 namespace {
-    // pretty cool idea I found at `Daily bit(e) of C++` blog
-    struct Ignore {
-        std::string_view str;
+    using day_19::Label;
+
+    // bumped whenever `Rule`, `Part` or the serialized system change
+    constexpr auto CACHE_SCHEMA = std::uint32_t{2};
 
-        friend auto operator>>(std::istream& stream, const Ignore& ctx) -> std::istream& {
-            return stream.ignore(static_cast<std::streamsize>(ctx.str.length()));
-        }
-    };
 
     template<typename Item, class Project, class Condition, class ConditionMaker>
     struct RuleBase {
-        Project     project;
-        Condition   condition;
-        std::string destination;
-
-        friend auto operator>>(std::istream& stream, RuleBase& rule) -> std::istream& {
-            // done reading rules
-            if (stream.peek() == '}') {
-                stream.setstate(std::ios::failbit);
-                return stream;
+        Project   project;
+        Condition condition;
+        Label     destination = day_19::REJECTED;
+
+        static auto from(const day_19::Rule& source) -> RuleBase {
+            auto rule        = RuleBase{};
+            rule.destination = source.destination;
+            switch (source.category) {
+                case 'x': rule.project = &Item::x; break;
+                case 'm': rule.project = &Item::m; break;
+                case 'a': rule.project = &Item::a; break;
+                case 's': rule.project = &Item::s; break;
+                default: return rule;  // not a condition, a label
             }
 
-            const auto type              = stream.get();
-            const auto is_next_separator = [&]() -> bool { return std::isalnum(stream.peek()) == 0; };
-            if (type == 'x' and is_next_separator()) {
-                rule.project = &Item::x;
-            } else if (type == 'm' and is_next_separator()) {
-                rule.project = &Item::m;
-            } else if (type == 'a' and is_next_separator()) {
-                rule.project = &Item::a;
-            } else if (type == 's' and is_next_separator()) {
-                rule.project = &Item::s;
-            } else {
-                // not a condition, a label
-                auto label = std::string{static_cast<char>(type)};
-                while (stream.peek() != '}') {
-                    label.push_back(static_cast<char>(stream.get()));
-                }
-                rule.project     = {};
-                rule.condition   = {};
-                rule.destination = label;
-                return stream;
-            }
+            rule.condition = ConditionMaker{}(source.condition, source.threshold);
+            return rule;
+        }
+    };
 
-            const auto condition = stream.get();
-            const auto threshold = core::io::read<std::uint64_t>(stream);
-            stream >> Ignore{":"};
+    template<class Rule>
+    struct WorkflowBase {
+        Label             label = day_19::REJECTED;
+        std::vector<Rule> rules;
+    };
 
-            auto label = std::string{};
-            while (stream.peek() != '}' and stream.peek() != ',') {
-                label.push_back(static_cast<char>(stream.get()));
-            }
-            rule.destination = label;
+    // keeps the indexing by label
+    template<class Workflow>
+    auto make_workflows(const day_19::Workflows& source) -> std::vector<Workflow> {
+        using Rule = typename decltype(Workflow::rules)::value_type;
 
-            if (stream.peek() == ',') {
-                stream.ignore();
-            }
+        auto registry = std::vector<Workflow>(source.size());
+        for (auto label = 0ul; label != source.size(); label++) {
+            registry[label].label = source[label].label;
+            std::ranges::transform(source[label].rules, std::back_inserter(registry[label].rules), Rule::from);
+        }
+        return registry;
+    }
 
-            rule.condition = ConditionMaker{}(condition, threshold);
+    auto parse_rule(std::string_view record, core::Interner& labels) -> day_19::Rule {
+        // a<2006:qkq, or just the label to jump to
+        auto rule        = day_19::Rule{};
+        auto destination = std::string_view{};
+        if (core::record::parse<"%c%c%u:%s">(record, rule.category, rule.condition, rule.threshold, destination)
+            and std::string_view{"xmas"}.contains(rule.category)) {
+            rule.destination = labels.intern(destination);
+            return rule;
+        }
+        return day_19::Rule{.destination = labels.intern(record)};
+    }
 
-            return stream;
+    auto parse_workflow(std::string_view record, core::Interner& labels) -> day_19::Workflow {
+        // px{a<2006:qkq,m>2090:A,rfg}
+        auto label = std::string_view{};
+        auto rules = std::string_view{};
+        if (not core::record::parse<"%s{%s}">(record, label, rules)) {
+            throw std::runtime_error(std::format("Failed to parse workflow from <{}>", record));
         }
-    };
 
-    template<class Rule>
-    struct Workflow {
-        std::string       label;
-        std::vector<Rule> rules;
+        auto workflow = day_19::Workflow{.label = labels.intern(label), .rules = {}};
+        for (const auto rule : core::strings::split_view(rules, ",")) {
+            workflow.rules.push_back(parse_rule(rule, labels));
+        }
+        return workflow;
+    }
 
-        friend auto operator>>(std::istream& stream, Workflow& workflow) -> std::istream& {
-            // workflows end with an empty line
-            if (stream.peek() == '\n') {
-                stream.ignore();
-                stream.setstate(std::ios::failbit);
-                return stream;
-            }
+    auto parse_part(std::string_view record) -> day_19::Part {
+        auto part = day_19::Part{};
+        if (not core::record::parse<"{x=%u,m=%u,a=%u,s=%u}">(record, part.x, part.m, part.a, part.s)) {
+            throw std::runtime_error(std::format("Failed to parse part from <{}>", record));
+        }
+        return part;
+    }
+
+    // field by field, a rule has padding that would make the entry differ between runs
+    auto save_rule(const day_19::Rule& rule, core::cache::Writer& writer) -> void {
+        writer.write(rule.category);
+        writer.write(rule.condition);
+        writer.write(rule.threshold);
+        writer.write(rule.destination);
+    }
+
+    auto load_rule(core::cache::Reader& reader) -> day_19::Rule {
+        auto rule        = day_19::Rule{};
+        rule.category    = reader.read<char>();
+        rule.condition   = reader.read<char>();
+        rule.threshold   = reader.read<std::uint64_t>();
+        rule.destination = reader.read<Label>();
+        return rule;
+    }
 
-            auto label = std::string{};
-            while (stream.peek() != '{') {
-                label.push_back(static_cast<char>(stream.get()));
+    // labels go first and are interned again in id order, so every stored id stays valid
+    auto save(const day_19::System& system, core::cache::Writer& writer) -> void {
+        writer.write(system.labels.size());
+        for (auto label = Label{0}; label != system.labels.size(); label++) {
+            writer.write_string(system.labels.name(label));
+        }
+
+        for (const auto& workflow : system.workflows) {
+            writer.write(workflow.label);
+            writer.write(workflow.rules.size());
+            for (const auto& rule : workflow.rules) {
+                save_rule(rule, writer);
             }
-            workflow.label = label;
+        }
+
+        static_assert(std::has_unique_object_representations_v<day_19::Part>, "parts are written as bytes");
+        writer.write_span(std::span{system.parts});
+    }
+
+    auto load(core::cache::Reader& reader) -> day_19::System {
+        auto system = day_19::System{};
 
-            stream >> Ignore{"{"};
-            workflow.rules = core::io::read_sequence<Rule>(stream);
-            stream.clear();
-            return stream >> Ignore{"}\n"};
+        const auto labels = reader.read<std::size_t>();
+        for (auto label = 0ul; label != labels; label++) {
+            system.labels.intern(reader.read_string());
         }
-    };
 
-    template<class Workflow>
-    auto load_workflows(std::istream& stream) -> std::unordered_map<std::string, Workflow> {
-        auto registry = std::unordered_map<std::string, Workflow>{};
-        std::ranges::move(
-            std::views::istream<Workflow>(stream) | std::views::transform([](Workflow& workflow) {
-                auto label = workflow.label;  // NOLINT: clang-tidy doesn't recognize that we do copy here
-                return std::pair(std::move(label), std::move(workflow));
-            }),
-            std::inserter(registry, registry.end())
-        );
-        stream.clear();
-        return registry;
+        system.workflows.resize(labels);
+        for (auto& workflow : system.workflows) {
+            workflow.label   = reader.read<Label>();
+            const auto rules = reader.read<std::size_t>();
+            for (auto rule = 0ul; rule != rules; rule++) {
+                workflow.rules.push_back(load_rule(reader));
+            }
+        }
+
+        const auto parts = reader.read_span<day_19::Part>();
+        system.parts.assign(parts.begin(), parts.end());
+        return system;
     }
 }  // namespace
 
-namespace part_one {
+namespace ratings {
     struct Item {
         std::uint64_t x = 0;
         std::uint64_t m = 0;
@@ -134,15 +170,6 @@ namespace part_one {
         [[nodiscard]] auto value() const -> std::uint64_t {
             return x + m + a + s;
         }
-
-        friend std::istream& operator>>(std::istream& stream, Item& item) {
-            stream >> Ignore{"{x="} >> item.x;
-            stream >> Ignore{",m="} >> item.m;
-            stream >> Ignore{",a="} >> item.a;
-            stream >> Ignore{",s="} >> item.s;
-
-            return stream >> Ignore{"}\n"};
-        }
     };
 
     using Project   = std::function<std::uint64_t(const Item&)>;
@@ -160,8 +187,8 @@ namespace part_one {
 
     using Rule = RuleBase<Item, Project, Condition, ConditionMaker>;
 
-    struct Workflow : ::Workflow<Rule> {
-        [[nodiscard]] auto process(const Item& item) const -> std::string {
+    struct Workflow : WorkflowBase<Rule> {
+        [[nodiscard]] auto process(const Item& item) const -> Label {
             for (const auto& [project, condition, destination] : rules) {
                 if (not project or not condition) {
                     return destination;
@@ -172,31 +199,27 @@ namespace part_one {
                 }
             }
 
-            return {};
+            throw std::runtime_error("The item fell through the workflow");
         }
     };
 
-    auto load_items(std::istream& stream) -> std::vector<Item> {
-        return core::io::read_sequence<Item>(stream);
-    }
+    auto total_value_of_accepted_items(const day_19::System& system) -> std::uint64_t {
+        const auto workflows = make_workflows<Workflow>(system.workflows);
 
-    auto total_value_of_accepted_items(const std::filesystem::path& path) -> std::uint64_t {
-        auto       stream    = std::ifstream{path};
-        const auto workflows = load_workflows<Workflow>(stream);
-        const auto items     = load_items(stream);
+        return std::ranges::fold_left(system.parts, 0ull, [&](std::uint64_t accumulator, const day_19::Part& part) {
+            const auto item = Item{.x = part.x, .m = part.m, .a = part.a, .s = part.s};
 
-        return std::ranges::fold_left(items, 0ull, [&](std::uint64_t accumulator, const Item& item) {
-            auto current = std::string{"in"};
-            while (current != "A" and current != "R") {
-                current = workflows.at(current).process(item);
+            auto current = day_19::START;
+            while (current != day_19::ACCEPTED and current != day_19::REJECTED) {
+                current = workflows[current].process(item);
             }
 
-            return (current == "A") ? accumulator + item.value() : accumulator;
+            return (current == day_19::ACCEPTED) ? accumulator + item.value() : accumulator;
         });
     }
-}  // namespace part_one
+}  // namespace ratings
 
-namespace part_two {
+namespace combinations {
     constexpr auto MAX_RANK = 4000ull;
 
     struct Range {
@@ -244,19 +267,18 @@ namespace part_two {
 
 
     auto search(
-        const std::unordered_map<std::string, Workflow<Rule>>& workflows, std::vector<Item>& accepted,
-        const std::string& label, Item value
-    ) {
-        if (label == "A") {
+        const std::vector<WorkflowBase<Rule>>& workflows, std::vector<Item>& accepted, Label label, Item value
+    ) -> void {
+        if (label == day_19::ACCEPTED) {
             accepted.push_back(value);
             return;
         }
 
-        if (label == "R") {
+        if (label == day_19::REJECTED) {
             return;
         }
 
-        for (const auto& [project, condition, destination] : workflows.at(label).rules) {
+        for (const auto& [project, condition, destination] : workflows[label].rules) {
             // no condition means that we are jumping to a new label
             if (not condition || not project) {
                 search(workflows, accepted, destination, value);
@@ -284,24 +306,59 @@ namespace part_two {
         }
     }
 
-    auto count_distinct_accepted_combinations(const std::filesystem::path& path) -> std::uint64_t {
-        auto       stream    = std::ifstream{path};
-        const auto workflows = load_workflows<Workflow<Rule>>(stream);
+    auto count_distinct_accepted_combinations(const day_19::System& system) -> std::uint64_t {
+        const auto workflows = make_workflows<WorkflowBase<Rule>>(system.workflows);
 
         auto accepted = std::vector<Item>{};
-        search(workflows, accepted, "in", {});
+        search(workflows, accepted, day_19::START, {});
         return std::ranges::fold_left(accepted, 0ull, [](std::uint64_t accumulator, const Item& item) {
             return accumulator + item.combinations();
         });
     }
-}  // namespace part_two
+}  // namespace combinations
 
-int main() {
-    const auto path = std::filesystem::path{"input.data"};
 
-    std::cout << std::format("The total value of accepted items is {}\n", part_one::total_value_of_accepted_items(path));
-    std::cout << std::format(
-        "There will be accepted {} of distinct combinations", part_two::count_distinct_accepted_combinations(path)
-    );
-    return 0;
-}
+namespace day_19 {
+    auto parse(std::string_view input) -> System {
+        auto system = System{};
+        for (const auto label : {"A", "R", "in"}) {
+            system.labels.intern(label);
+        }
+
+        // workflows, an empty line and then parts
+        auto records = core::strings::split_view(input, "\n");
+        auto record  = records.begin();
+        for (; record != records.end() && not (*record).empty(); ++record) {
+            auto workflow    = parse_workflow(*record, system.labels);
+            const auto label = workflow.label;
+            system.workflows.resize(system.labels.size());
+            system.workflows[label] = std::move(workflow);
+        }
+        system.workflows.resize(system.labels.size());
+
+        for (; record != records.end(); ++record) {
+            if (not (*record).empty()) {
+                system.parts.push_back(parse_part(*record));
+            }
+        }
+        return system;
+    }
+
+    auto part_one(const System& system) -> std::uint64_t {
+        return ratings::total_value_of_accepted_items(system);
+    }
+
+    auto part_two(const System& system) -> std::uint64_t {
+        return combinations::count_distinct_accepted_combinations(system);
+    }
+
+    auto solve(std::string_view input) -> core::Answers {
+        const auto system = parse(input);
+        return {std::format("{}", part_one(system)), std::format("{}", part_two(system))};
+    }
+
+    auto solve_cached(std::string_view input, const core::cache::Store& store) -> core::Answers {
+        const auto system = store.load_or_parse("day-19", CACHE_SCHEMA, input, parse, save, load);
+        return {std::format("{}", part_one(system)), std::format("{}", part_two(system))};
+    }
+}  // namespace day_19
@@ -0,0 +1,60 @@
+#ifndef APLENTY_HXX
+#define APLENTY_HXX
+
+#include <core/interner.hxx>
+#include <core/solution.hxx>
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+
+namespace core::cache {
+    class Store;
+}  // namespace core::cache
+
+
+namespace day_19 {
+    using Label = core::Interner::Id;
+
+    // interned before anything else, so their ids are fixed
+    constexpr auto ACCEPTED = Label{0};
+    constexpr auto REJECTED = Label{1};
+    constexpr auto START    = Label{2};
+
+    struct Rule {
+        char          category    = 0;  // one of `xmas`, zero for the rule that always jumps
+        char          condition   = 0;  // either '<' or '>'
+        std::uint64_t threshold   = 0;
+        Label         destination = REJECTED;
+    };
+
+    struct Workflow {
+        Label             label = REJECTED;
+        std::vector<Rule> rules;
+    };
+
+    struct Part {
+        std::uint64_t x = 0;
+        std::uint64_t m = 0;
+        std::uint64_t a = 0;
+        std::uint64_t s = 0;
+    };
+
+    // indexed by label, `A`, `R` and labels that are never defined have no rules
+    using Workflows = std::vector<Workflow>;
+
+    struct System {
+        core::Interner    labels;
+        Workflows         workflows;
+        std::vector<Part> parts;
+    };
+
+    auto parse(std::string_view input) -> System;
+    auto part_one(const System& system) -> std::uint64_t;
+    auto part_two(const System& system) -> std::uint64_t;
+    auto solve(std::string_view input) -> core::Answers;
+    auto solve_cached(std::string_view input, const core::cache::Store& store) -> core::Answers;
+}  // namespace day_19
+
+#endif  // APLENTY_HXX
@@ -0,0 +1,18 @@
+#include "aplenty.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto path   = std::filesystem::path{"input.data"};
+    const auto data   = core::io::MappedFile{path};
+    const auto system = day_19::parse(data.view());
+
+    std::cout << std::format("The total value of accepted items is {}\n", day_19::part_one(system));
+    std::cout << std::format("There will be accepted {} of distinct combinations", day_19::part_two(system));
+    return 0;
+}
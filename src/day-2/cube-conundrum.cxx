@@ -1,57 +1,51 @@
-#include <core/numbers.hxx>
+#include "cube-conundrum.hxx"
+
+#include <core/cache.hxx>
+#include <core/io.hxx>
+#include <core/parallel.hxx>
+#include <core/record.hxx>
 #include <core/strings.hxx>
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <format>
-#include <fstream>
-#include <iostream>
 #include <iterator>
-#include <numeric>
-#include <ranges>
-#include <regex>
+#include <span>
 #include <stdexcept>
-#include <string>
 #include <string_view>
 #include <vector>
 
 
 namespace {
+    using day_2::Game;
+    using day_2::Games;
+    using day_2::Set;
+
+
     constexpr auto RED   = "red";
     constexpr auto GREEN = "green";
     constexpr auto BLUE  = "blue";
 
-
-    struct Set {
-        std::size_t red   = 0;
-        std::size_t green = 0;
-        std::size_t blue  = 0;
+    constexpr auto SESSION_SET = Set{
+        .red   = 12,
+        .green = 13,
+        .blue  = 14,
     };
 
-    struct Game {
-        std::size_t      id = 0;
-        std::vector<Set> sets;
-    };
+    // bumped whenever `Set` or the serialized games change
+    constexpr auto CACHE_SCHEMA = std::uint32_t{1};
 
-    auto extract_game_id(std::string_view str) -> std::size_t {
-        std::match_results<std::string_view::const_iterator> match;
-        if (std::regex_match(str.cbegin(), str.cend(), match, std::regex{R"(Game (\d+))"})) {
-            return core::numbers::parse<std::size_t>(match[1].str());
-        }
-        return 0;
-    }
 
     auto parse_set_record(std::string_view record) -> Set {
-        const auto parts   = core::strings::split(record, ", ");
-        const auto pattern = std::regex{R"((\d+)\s+(\w+))"};
-
         Set set;
-        for (const auto part : parts) {
-            std::match_results<std::string_view::const_iterator> match;
-            std::regex_match(part.cbegin(), part.cend(), match, pattern);
+        for (const auto part : core::strings::split_view(record, ", ")) {
+            auto count = std::size_t{0};
+            auto color = std::string_view{};
+            if (not core::record::parse<"%u %s">(part, count, color)) {
+                throw std::runtime_error(std::format("Failed to parse cubes from <{}>", part));
+            }
 
-            const auto count = std::stoul(match[1].str());
-            const auto color = std::string_view{match[2].first, match[2].second};
             if (color == RED) {
                 set.red = count;
             } else if (color == GREEN) {
@@ -70,27 +64,16 @@ namespace {
     }
 
     auto parse_game_record(std::string_view record) -> Game {
-        const auto parts = core::strings::split(record, ": ");
-        return {
-            .id   = extract_game_id(parts[0]),
-            .sets = parse_sets_record(parts[1]),
-        };
-    }
-
-    auto load_games(const std::string& path) -> std::vector<Game> {
-        std::ifstream file{path};
-        if (!file.is_open()) {
-            throw std::runtime_error("Failed to open file: " + path);
-        }
-
-        std::vector<Game> games;
-
-        std::string record;
-        while (std::getline(file, record)) {
-            games.emplace_back(parse_game_record(record));
+        auto id   = std::size_t{0};
+        auto sets = std::string_view{};
+        if (not core::record::parse<"Game %u: %s">(record, id, sets)) {
+            throw std::runtime_error(std::format("Failed to parse game from <{}>", record));
         }
 
-        return games;
+        return {
+            .id   = id,
+            .sets = parse_sets_record(sets),
+        };
     }
 
     auto is_valid_game(const Game& game, const Set& set) -> bool {
@@ -99,10 +82,9 @@ namespace {
         });
     }
 
-    auto get_total_score(const std::vector<Game>& games, const Set& set) -> std::size_t {
-        auto valid_games = games | std::views::filter([&set](const Game& game) { return is_valid_game(game, set); });
-        return std::reduce(valid_games.begin(), valid_games.end(), std::size_t{0}, [](std::size_t prefix, const Game& game) {
-            return prefix + game.id;
+    auto get_total_score(const Games& games, const Set& set) -> std::size_t {
+        return core::parallel::sum(games, std::size_t{0}, [&set](const Game& game) {
+            return is_valid_game(game, set) ? game.id : 0;
         });
     }
 
@@ -116,33 +98,72 @@ namespace {
         return power_set.red * power_set.green * power_set.blue;
     }
 
-    auto get_total_power_score(const std::vector<Game>& games) -> std::size_t {
-        return std::reduce(games.cbegin(), games.cend(), std::size_t{0}, [](std::size_t prefix, const Game& game) {
-            return prefix + get_game_power_score(game);
-        });
+    auto get_total_power_score(const Games& games) -> std::size_t {
+        return core::parallel::sum(games, std::size_t{0}, get_game_power_score);
     }
 
+
+    auto save(const Games& games, core::cache::Writer& writer) -> void {
+        writer.write(games.size());
+        for (const auto& game : games) {
+            writer.write(game.id);
+            writer.write_span(std::span{game.sets});
+        }
+    }
+
+    auto load(core::cache::Reader& reader) -> Games {
+        auto games = Games(reader.read<std::size_t>());
+        for (auto& game : games) {
+            game.id         = reader.read<std::size_t>();
+            const auto sets = reader.read_span<Set>();
+            game.sets.assign(sets.begin(), sets.end());
+        }
+        return games;
+    }
 }  // namespace
 
 
-auto main() -> int {
-    try {
-        const auto games = load_games("input.data");
+namespace day_2 {
+    auto parse(std::string_view input) -> Games {
+        auto games = Games{};
+        for (const auto record : core::strings::split_view(input, "\n")) {
+            if (not record.empty()) {
+                games.emplace_back(parse_game_record(record));
+            }
+        }
+        return games;
+    }
 
-        const auto session_set = Set{
-            .red   = 12,
-            .green = 13,
-            .blue  = 14,
-        };
-        const auto total_score = get_total_score(games, session_set);
-        std::cout << std::format("The total score is {}\n", total_score);
-
-        const auto power_score = get_total_power_score(games);
-        std::cout << std::format("The total power score is {}\n", power_score);
-    } catch (const std::exception& ex) {  // NOLINT: std::exception if fine here
-        std::cerr << std::format("Critical error: {}\n", ex.what());
-        return 1;
+    auto part_one(const Games& games) -> std::size_t {
+        return get_total_score(games, SESSION_SET);
     }
 
-    return 0;
-}
+    auto part_two(const Games& games) -> std::size_t {
+        return get_total_power_score(games);
+    }
+
+    auto solve(std::string_view input) -> core::Answers {
+        const auto games = parse(input);
+        return {std::format("{}", part_one(games)), std::format("{}", part_two(games))};
+    }
+
+    auto solve_stream(core::io::LineReader& input) -> core::Answers {
+        auto score       = std::size_t{0};
+        auto power_score = std::size_t{0};
+        while (const auto record = input.next()) {
+            if (record->empty()) {
+                continue;
+            }
+
+            const auto game = parse_game_record(*record);
+            score += is_valid_game(game, SESSION_SET) ? game.id : 0;
+            power_score += get_game_power_score(game);
+        }
+        return {std::format("{}", score), std::format("{}", power_score)};
+    }
+
+    auto solve_cached(std::string_view input, const core::cache::Store& store) -> core::Answers {
+        const auto games = store.load_or_parse("day-2", CACHE_SCHEMA, input, parse, save, load);
+        return {std::format("{}", part_one(games)), std::format("{}", part_two(games))};
+    }
+}  // namespace day_2
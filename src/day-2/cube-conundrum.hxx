@@ -0,0 +1,38 @@
+#ifndef CUBE_CONUNDRUM_HXX
+#define CUBE_CONUNDRUM_HXX
+
+#include <core/solution.hxx>
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+
+namespace core::cache {
+    class Store;
+}  // namespace core::cache
+
+
+namespace day_2 {
+    struct Set {
+        std::size_t red   = 0;
+        std::size_t green = 0;
+        std::size_t blue  = 0;
+    };
+
+    struct Game {
+        std::size_t      id = 0;
+        std::vector<Set> sets;
+    };
+
+    using Games = std::vector<Game>;
+
+    auto parse(std::string_view input) -> Games;
+    auto part_one(const Games& games) -> std::size_t;
+    auto part_two(const Games& games) -> std::size_t;
+    auto solve(std::string_view input) -> core::Answers;
+    auto solve_stream(core::io::LineReader& input) -> core::Answers;
+    auto solve_cached(std::string_view input, const core::cache::Store& store) -> core::Answers;
+}  // namespace day_2
+
+#endif  // CUBE_CONUNDRUM_HXX
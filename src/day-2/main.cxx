@@ -0,0 +1,27 @@
+#include "cube-conundrum.hxx"
+
+#include <core/io.hxx>
+
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+auto main() -> int {
+    try {
+        const auto data  = core::io::MappedFile{std::filesystem::path{"input.data"}};
+        const auto games = day_2::parse(data.view());
+
+        const auto total_score = day_2::part_one(games);
+        std::cout << std::format("The total score is {}\n", total_score);
+
+        const auto power_score = day_2::part_two(games);
+        std::cout << std::format("The total power score is {}\n", power_score);
+    } catch (const std::exception& ex) {  // NOLINT: std::exception if fine here
+        std::cerr << std::format("Critical error: {}\n", ex.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -1,67 +1,100 @@
 #include "connection-mesh.hxx"
-#include "core/io.hxx"
+
+#include <core/csr-graph.hxx>
+#include <core/profile.hxx>
+#include <core/scan.hxx>
+#include <core/strings.hxx>
 
 #include <algorithm>
-#include <cctype>
-#include <istream>
+#include <format>
 #include <ranges>
-#include <string>
+#include <stdexcept>
+#include <string_view>
 #include <utility>
 #include <variant>
 #include <vector>
 
 
 namespace {
-    auto read_label(std::istream& stream) -> std::string {
-        const auto label = core::io::read_string(stream, [](int symbol) -> bool { return std::isalpha(symbol) != 0; });
-        core::io::skip(stream, [](int symbol) -> bool { return symbol != '\n' and std::isalpha(symbol) == 0; });
-        return label;
-    }
+    using day_20::Broadcaster;
+    using day_20::Conjunction;
+    using day_20::ConnectionMesh;
+    using day_20::FlipFlop;
+    using day_20::Label;
+    using day_20::Signal;
+
+
+    // A destination listed twice is still one wire, or the conjunction at its end would remember the sender twice.
+    auto parse_connections(
+        std::string_view destinations, core::Interner& labels, Label from, std::vector<core::CsrGraph::Edge>& edges
+    ) -> void {
+        const auto first = edges.size();
+        for (const auto destination : core::strings::split_view(destinations, ",")) {
+            const auto name = core::strings::strip(destination);
+            if (name.empty()) {
+                continue;
+            }
 
-    auto parse_connections(std::istream& stream) -> std::vector<std::string> {
-        auto connections = std::vector<std::string>{};
-        while (stream && stream.peek() != '\n') {
-            connections.push_back(read_label(stream));
+            const auto to = labels.intern(name);
+            if (std::ranges::find(edges | std::views::drop(first), to, &core::CsrGraph::Edge::to) == edges.end()) {
+                edges.push_back({.from = from, .to = to});
+            }
         }
-        return connections;
     }
 
-    auto parse_connection_mesh(std::istream& stream) -> ConnectionMesh {
-        auto mesh         = ConnectionMesh{};
-        auto conjunctions = std::vector<std::string>{};
-        while (stream) {
-            const auto type = stream.peek();
-            if (std::isalnum(type) == 0) {
-                stream.ignore();
+    auto parse_connection_mesh(std::string_view diagram) -> ConnectionMesh {
+        auto mesh = ConnectionMesh{};
+        mesh.labels.intern("button");
+        mesh.labels.intern("broadcaster");
+
+        auto edges        = std::vector<core::CsrGraph::Edge>{};
+        auto conjunctions = std::vector<Label>{};
+        for (const auto line : core::strings::split_view(diagram, "\n")) {
+            const auto record = core::strings::strip(line);
+            if (record.empty()) {
+                continue;
+            }
+
+            // %a -> b, c
+            const auto arrow = core::scan::find(record, "->");
+            if (arrow == std::string_view::npos) {
+                throw std::runtime_error(std::format("Invalid module {}", record));
+            }
+
+            auto       name = core::strings::strip(record.substr(0, arrow));
+            const auto type = name.front();
+            if (type == '%' || type == '&') {
+                name.remove_prefix(1);
             }
 
-            const auto label       = read_label(stream);
-            auto       connections = parse_connections(stream);
+            const auto label = mesh.labels.intern(name);
+            parse_connections(record.substr(arrow + 2), mesh.labels, label, edges);
+            mesh.modules.resize(mesh.labels.size());
             switch (type) {
                 case '%': {
-                    mesh.modules[label] = FlipFlop{label, Signal::Strength::LOW, std::move(connections)};
+                    mesh.modules[label] = FlipFlop{label, Signal::Strength::LOW};
                     break;
                 }
 
                 case '&': {
-                    mesh.modules[label] = Conjunction{label, {}, std::move(connections)};
+                    mesh.modules[label] = Conjunction{label, {}};
                     conjunctions.push_back(label);
                     break;
                 }
 
                 default: {
-                    mesh.modules[label] = Broadcaster{label, std::move(connections)};
+                    mesh.modules[label] = Broadcaster{label};
                     break;
                 }
             }
-            stream.ignore();
         }
 
-        for (const auto& label : conjunctions) {
-            for (auto& [other_label, other] : mesh.modules) {
-                if (std::visit([&](auto& module) { return module.sends_to(label); }, other)) {
-                    std::get<Conjunction>(mesh.modules[label]).state[other_label] = Signal::Strength::LOW;
-                }
+        mesh.modules.resize(mesh.labels.size());
+        mesh.wiring = core::CsrGraph{mesh.labels.size(), edges, true};
+        for (const auto label : conjunctions) {
+            auto& conjunction = std::get<Conjunction>(*mesh.modules[label]);
+            for (const auto input : mesh.wiring.predecessors(label)) {
+                conjunction.state.emplace_back(input, Signal::Strength::LOW);
             }
         }
 
@@ -69,94 +102,108 @@ namespace {
     }
 }  // namespace
 
-auto Button::press(ConnectionMesh& mesh) -> void {
-    mesh.send_signal(Signal::Strength::LOW, "button", "broadcaster");
-}
+namespace day_20 {
+    auto Button::press(ConnectionMesh& mesh) -> void {
+        mesh.send_signal(Signal::Strength::LOW, ConnectionMesh::BUTTON, ConnectionMesh::BROADCASTER);
+    }
 
-auto Broadcaster::receive_signal(ConnectionMesh& mesh, Signal::Strength signal, const std::string&) -> void {
-    for (const auto& dest : connections) {
-        mesh.send_signal(signal, label, dest);
+    auto Broadcaster::receive_signal(ConnectionMesh& mesh, Signal::Strength signal, Label) -> void {
+        for (const auto dest : mesh.wiring.successors(label)) {
+            mesh.send_signal(signal, label, dest);
+        }
     }
-}
 
-auto Conjunction::receive_signal(ConnectionMesh& mesh, Signal::Strength signal, const std::string& from) -> void {
-    state[from] = signal;
+    auto Conjunction::receive_signal(ConnectionMesh& mesh, Signal::Strength signal, Label from) -> void {
+        const auto input = std::ranges::find(state, from, &std::pair<Label, Signal::Strength>::first);
+        if (input != state.end()) {
+            input->second = signal;
+        } else {
+            state.emplace_back(from, signal);
+        }
 
-    const auto is_high = [](Signal::Strength signal) { return signal == Signal::Strength::HIGH; };
-    signal = std::ranges::all_of(state | std::views::values, is_high) ? Signal::Strength::LOW : Signal::Strength::HIGH;
-    for (const auto& dest : connections) {
-        mesh.send_signal(signal, label, dest);
+        const auto is_high = [](Signal::Strength signal) { return signal == Signal::Strength::HIGH; };
+        signal = std::ranges::all_of(state | std::views::values, is_high) ? Signal::Strength::LOW : Signal::Strength::HIGH;
+        for (const auto dest : mesh.wiring.successors(label)) {
+            mesh.send_signal(signal, label, dest);
+        }
     }
-}
 
-auto FlipFlop::receive_signal(ConnectionMesh& mesh, Signal::Strength signal, const std::string&) -> void {
-    if (signal == Signal::Strength::LOW) {
-        flip();
-        for (const auto& dest : connections) {
-            mesh.send_signal(state, label, dest);
+    auto FlipFlop::receive_signal(ConnectionMesh& mesh, Signal::Strength signal, Label) -> void {
+        if (signal == Signal::Strength::LOW) {
+            flip();
+            for (const auto dest : mesh.wiring.successors(label)) {
+                mesh.send_signal(state, label, dest);
+            }
         }
     }
-}
 
-auto ConnectionMesh::set_track_connection(const std::string& target) -> void {
-    if (target.empty()) {
-        tracked.clear();
-        tracked_source.clear();
-        triggers.clear();
-    }
+    auto ConnectionMesh::set_track_connection(std::string_view target) -> void {
+        if (target.empty()) {
+            tracked        = core::Interner::NONE;
+            tracked_source = core::Interner::NONE;
+            triggers.clear();
+            return;
+        }
+
+        const auto label = labels.find(target);
+        if (not label) {
+            return;
+        }
 
-    for (const auto& [name, module] : modules) {
-        if (std::visit([&](const auto& source) { return source.sends_to(target); }, module)) {
-            tracked        = target;
-            tracked_source = name;
+        // the puzzle feeds its target from a single conjunction, whose inputs each fire high on a cycle of their own
+        const auto sources = wiring.predecessors(*label);
+        if (sources.size() != 1) {
+            throw std::runtime_error(std::format("{} has to be fed by exactly one module", target));
         }
+        tracked        = *label;
+        tracked_source = sources.front();
     }
-}
-
-auto ConnectionMesh::send_signal(Signal::Strength signal, const std::string& from, const std::string& to) -> void {
-    switch (signal) {
-        case Signal::Strength::HIGH: {
-            pending_signals.emplace(Signal::Strength::HIGH, from, to);
-            if (to == tracked) {
-                high_signals++;
+
+    auto ConnectionMesh::send_signal(Signal::Strength signal, Label from, Label to) -> void {
+        switch (signal) {
+            case Signal::Strength::HIGH: {
+                pending_signals.emplace(Signal::Strength::HIGH, from, to);
+                if (to == tracked) {
+                    high_signals++;
+                }
+                break;
             }
-            break;
-        }
 
-        case Signal::Strength::LOW: {
-            pending_signals.emplace(Signal::Strength::LOW, from, to);
-            if (to == tracked) {
-                low_signals++;
+            case Signal::Strength::LOW: {
+                pending_signals.emplace(Signal::Strength::LOW, from, to);
+                if (to == tracked) {
+                    low_signals++;
+                }
+                break;
             }
-            break;
         }
     }
-}
 
-auto ConnectionMesh::process_signal() -> bool {
-    if (pending_signals.empty()) {
-        return false;
-    }
+    auto ConnectionMesh::process_signal() -> bool {
+        if (pending_signals.empty()) {
+            return false;
+        }
 
-    const auto [signal, from, to] = pending_signals.front();
-    pending_signals.pop();
+        const auto [signal, from, to] = pending_signals.front();
+        pending_signals.pop();
+        CORE_PROFILE_COUNT("day-20/signals", 1);
 
-    if (to == tracked_source) {
-        if (signal == Signal::Strength::HIGH) {
-            triggers.insert(from);
+        if (to == tracked_source) {
+            if (signal == Signal::Strength::HIGH) {
+                triggers.insert(from);
+            }
         }
-    }
 
-    const auto it = modules.find(to);
-    if (it == modules.end()) {
+        auto& module = modules[to];
+        if (not module) {
+            return true;
+        }
+
+        std::visit([&](auto& receiver) { receiver.receive_signal(*this, signal, from); }, *module);
         return true;
     }
 
-    std::visit([&](auto& module) { module.receive_signal(*this, signal, from); }, it->second);
-    return true;
-}
-
-auto operator>>(std::istream& stream, ConnectionMesh& mesh) -> std::istream& {
-    mesh = parse_connection_mesh(stream);
-    return stream;
-}
+    auto ConnectionMesh::load(std::string_view diagram) -> ConnectionMesh {
+        return parse_connection_mesh(diagram);
+    }
+}  // namespace day_20
@@ -1,94 +1,97 @@
 #ifndef CONNECTION_MESH_HXX
 #define CONNECTION_MESH_HXX
 
-#include <algorithm>
+#include <core/csr-graph.hxx>
+#include <core/flat-hash.hxx>
+#include <core/interner.hxx>
+
 #include <cstddef>
 #include <cstdint>
-#include <istream>
+#include <optional>
 #include <queue>
-#include <string>
-#include <unordered_map>
-#include <unordered_set>
+#include <string_view>
+#include <utility>
 #include <variant>
 #include <vector>
 
-struct ConnectionMesh;
 
-struct Signal {
-    enum class Strength : std::uint8_t {
-        LOW,
-        HIGH,
-    };
+namespace day_20 {
+    struct ConnectionMesh;
+
+    using Label = core::Interner::Id;
 
-    Strength    signal = Strength::LOW;
-    std::string from;
-    std::string to;
-};
+    struct Signal {
+        enum class Strength : std::uint8_t {
+            LOW,
+            HIGH,
+        };
+
+        Strength signal = Strength::LOW;
+        Label    from   = core::Interner::NONE;
+        Label    to     = core::Interner::NONE;
+    };
 
-struct FlipFlop {
-    std::string              label;
-    Signal::Strength         state;
-    std::vector<std::string> connections;
+    struct FlipFlop {
+        Label            label;
+        Signal::Strength state;
 
-    auto flip() -> void {
-        switch (state) {
-            case Signal::Strength::LOW: state = Signal::Strength::HIGH; break;
-            case Signal::Strength::HIGH: state = Signal::Strength::LOW; break;
+        auto flip() -> void {
+            switch (state) {
+                case Signal::Strength::LOW: state = Signal::Strength::HIGH; break;
+                case Signal::Strength::HIGH: state = Signal::Strength::LOW; break;
+            }
         }
-    }
-
-    auto receive_signal(ConnectionMesh&, Signal::Strength, const std::string& from) -> void;
-    auto sends_to(const std::string& label) const -> bool {
-        return std::ranges::contains(connections, label);
-    }
-};
-
-struct Conjunction {
-    std::string                                       label;
-    std::unordered_map<std::string, Signal::Strength> state;
-    std::vector<std::string>                          connections;
-
-    auto receive_signal(ConnectionMesh&, Signal::Strength, const std::string& from) -> void;
-    auto sends_to(const std::string& label) const -> bool {
-        return std::ranges::contains(connections, label);
-    }
-};
-
-struct Button {
-    void press(ConnectionMesh& mesh);
-};
-
-struct Broadcaster {
-    std::string              label;
-    std::vector<std::string> connections;
-
-    auto receive_signal(ConnectionMesh&, Signal::Strength, const std::string& from) -> void;
-    auto sends_to(const std::string& label) const -> bool {
-        return std::ranges::contains(connections, label);
-    }
-};
-
-struct ConnectionMesh {
-public:
-    using Module  = std::variant<Broadcaster, Conjunction, FlipFlop>;
-    using Modules = std::unordered_map<std::string, Module>;
-
-public:
-    Modules                         modules;
-    std::queue<Signal>              pending_signals;
-    std::size_t                     low_signals  = 0;
-    std::size_t                     high_signals = 0;
-    std::string                     tracked;
-    std::string                     tracked_source;
-    std::unordered_set<std::string> triggers;
-
-public:
-    auto set_track_connection(const std::string& target = {}) -> void;
-
-    auto send_signal(Signal::Strength signal, const std::string& from, const std::string& to) -> void;
-    auto process_signal() -> bool;
-
-    friend auto operator>>(std::istream& stream, ConnectionMesh& mesh) -> std::istream&;
-};
+
+        auto receive_signal(ConnectionMesh&, Signal::Strength, Label from) -> void;
+    };
+
+    struct Conjunction {
+        Label                                           label;
+        std::vector<std::pair<Label, Signal::Strength>> state;  // last signal of every input, there are only a few
+
+        auto receive_signal(ConnectionMesh&, Signal::Strength, Label from) -> void;
+    };
+
+    struct Button {
+        void press(ConnectionMesh& mesh);
+    };
+
+    struct Broadcaster {
+        Label label;
+
+        auto receive_signal(ConnectionMesh&, Signal::Strength, Label from) -> void;
+    };
+
+    struct ConnectionMesh {
+    public:
+        // interned before anything else, so their ids are fixed
+        static constexpr auto BUTTON      = Label{0};
+        static constexpr auto BROADCASTER = Label{1};
+
+        // empty for labels that only receive signals
+        using Module  = std::optional<std::variant<Broadcaster, Conjunction, FlipFlop>>;
+        using Modules = std::vector<Module>;
+
+    public:
+        core::Interner           labels;
+        Modules                  modules;  // indexed by label
+        core::CsrGraph           wiring;   // module outputs by label, with reverse edges for the inputs
+        std::queue<Signal>       pending_signals;
+        std::size_t              low_signals    = 0;
+        std::size_t              high_signals   = 0;
+        Label                    tracked        = core::Interner::NONE;
+        Label                    tracked_source = core::Interner::NONE;
+        core::FlatHashSet<Label> triggers;
+
+    public:
+        auto set_track_connection(std::string_view target = {}) -> void;
+
+        auto send_signal(Signal::Strength signal, Label from, Label to) -> void;
+        auto process_signal() -> bool;
+
+        // one `%a -> b, c` record per line
+        static auto load(std::string_view diagram) -> ConnectionMesh;
+    };
+}  // namespace day_20
 
 #endif  // CONNECTION_MESH_HXX
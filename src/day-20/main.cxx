@@ -0,0 +1,22 @@
+#include "pulse-propagation.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto path = std::filesystem::path{"input.data"};
+    const auto data = core::io::MappedFile{path};
+    const auto mesh = day_20::parse(data.view());
+
+    const auto pulse_count = day_20::part_one(mesh);
+    std::cout << std::format("The total number of pulses {} if we press button for 1000 times\n", pulse_count);
+
+    const auto required_pushes = day_20::part_two(mesh);
+    std::cout << std::format("We require to press button for {} times to send pulse to 'rx' module\n", required_pushes);
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+#ifndef PULSE_PROPAGATION_HXX
+#define PULSE_PROPAGATION_HXX
+
+#include "connection-mesh.hxx"
+
+#include <core/solution.hxx>
+
+#include <cstddef>
+#include <string_view>
+
+
+namespace day_20 {
+    auto parse(std::string_view input) -> ConnectionMesh;
+    auto part_one(const ConnectionMesh& mesh) -> std::size_t;
+    auto part_two(const ConnectionMesh& mesh) -> std::size_t;
+    auto solve(std::string_view input) -> core::Answers;
+}  // namespace day_20
+
+#endif  // PULSE_PROPAGATION_HXX
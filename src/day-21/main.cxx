@@ -0,0 +1,24 @@
+#include "step-counter.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto path   = std::filesystem::path{"input.data"};
+    const auto data   = core::io::MappedFile{path};
+    const auto garden = day_21::parse(data.view());
+
+    const auto step_count = day_21::STEPS;
+    const auto plot_count = day_21::part_one(garden, step_count);
+    std::cout << std::format("The Elf could read {} plots in exactly {} steps\n", plot_count, step_count);
+
+    const auto new_step_count = day_21::INFINITE_STEPS;
+    const auto new_plot_count = day_21::part_two(garden, new_step_count);
+    std::cout << std::format("The Elf could read {} plots in exactly {} steps\n", new_plot_count, new_step_count);
+
+    return 0;
+}
@@ -1,141 +1,176 @@
-#include <core/io.hxx>
-#include <core/strings.hxx>
+#include "step-counter.hxx"
+
+#include <core/bit-grid.hxx>
+#include <core/coordinate.hxx>
+#include <core/grid.hxx>
+#include <core/profile.hxx>
 
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <filesystem>
 #include <format>
-#include <functional>
-#include <iostream>
-#include <queue>
-#include <ranges>
+#include <iterator>
+#include <span>
+#include <stdexcept>
 #include <string_view>
-#include <tuple>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
 
 namespace {
-    using Grid = std::vector<std::string_view>;
+    using day_21::Grid;
+    using Coordinate = core::Coordinate;
+}  // namespace
 
-    struct Coordinate {
-        std::int64_t row = 0;
-        std::int64_t col = 0;
+namespace {
+    auto find_start_point(const Grid& grid) -> Coordinate {
+        const auto start = std::ranges::find(grid.cells(), 'S');
+        if (start == grid.cells().end()) {
+            return {};
+        }
+        return grid.coordinate(std::distance(grid.cells().begin(), start));
+    }
 
-        auto operator==(const Coordinate& other) const -> bool = default;
+    // number of plots first reached after each count of steps, indexed by that count
+    auto count_plots_by_distance(const Grid& grid) -> std::vector<std::size_t> {
+        CORE_PROFILE_ZONE("day-21/garden-bfs");
+
+        // the whole frontier advances one step at a time, a word of 64 plots per operation
+        const auto plots    = core::BitGrid::select(grid, [](char cell) { return cell != '#'; });
+        auto       frontier = core::BitGrid{grid.rows(), grid.cols()};
+        frontier.set(find_start_point(grid));
+
+        auto visited = frontier;
+        auto counts  = std::vector<std::size_t>{frontier.count()};
+        while (true) {
+            auto next = frontier.dilated();
+            next &= plots;
+            next.and_not(visited);
+
+            const auto reached = next.count();
+            if (reached == 0) {
+                break;
+            }
+            CORE_PROFILE_COUNT("day-21/steps", reached);
 
-        [[nodiscard]] Coordinate operator+(const Coordinate& other) const {
-            return Coordinate{
-                .row = row + other.row,
-                .col = col + other.col,
-            };
+            counts.push_back(reached);
+            visited |= next;
+            frontier = std::move(next);
         }
-    };
-}  // namespace
 
-template<>
-struct std::hash<Coordinate> {
-    auto operator()(const Coordinate& coordinate) const noexcept -> std::size_t {
-        const auto row_hash = std::hash<std::int64_t>{}(coordinate.row);
-        const auto col_hash = std::hash<std::int64_t>{}(coordinate.col);
-        return row_hash ^ (col_hash << 1);
+        return counts;
     }
-};
 
-namespace {
-    auto find_start_point(const Grid& grid) -> Coordinate {
-        for (auto row = 0; row != grid.size(); row++) {
-            for (auto col = 0; col != grid[row].size(); col++) {
-                if (grid[row][col] == 'S') {
-                    return Coordinate{row, col};
-                }
-            }
+    // plots reached after a number of steps that satisfies `predicate`
+    template<typename Predicate>
+    auto count_plots(std::span<const std::size_t> counts, Predicate predicate) -> std::size_t {
+        auto total = std::size_t{0};
+        for (auto distance = 0ul; distance != counts.size(); distance++) {
+            total += predicate(distance) ? counts[distance] : 0;
         }
-        return {};
+        return total;
     }
 
-    auto find_all_reachable_coorditates(const Grid& grid) -> std::unordered_map<Coordinate, std::size_t> {
-        auto visited = std::unordered_map<Coordinate, std::size_t>{};
-
-        const auto can_step = [&](const Coordinate& pos) {
-            if (pos.row < 0 or pos.row >= std::ssize(grid)) {
-                return false;
-            }
+    // plots reached after exactly `steps` steps, given the counts by distance
+    auto count_reachable(std::span<const std::size_t> counts, std::size_t steps) -> std::size_t {
+        return count_plots(counts, [steps](auto distance) { return distance <= steps and distance % 2 == steps % 2; });
+    }
 
-            if (pos.col < 0 or pos.col >= std::ssize(grid)) {
-                return false;
-            }
+    auto count_reachable_plots(const Grid& grid, std::size_t steps) -> std::size_t {
+        return count_reachable(count_plots_by_distance(grid), steps);
+    }
 
-            if (grid[pos.row][pos.col] == '#') {
-                return false;
+    // copies of the garden in each direction, enough for a walk out to the second ring of copies
+    constexpr auto TILES = Grid::Index{5};
+
+    // the garden repeated `TILES` times in both directions, with the start in the middle copy only
+    auto tile_garden(const Grid& grid) -> Grid {
+        auto tiled = Grid{grid.rows() * TILES, grid.cols() * TILES, 1, '.', '#'};
+        for (auto row = Grid::Index{0}; row != tiled.rows(); row++) {
+            const auto source = grid.row(row % grid.rows());
+            auto       target = tiled.row(row).begin();
+            for (auto copy = Grid::Index{0}; copy != TILES; copy++) {
+                target = std::ranges::replace_copy(source, target, 'S', '.').out;
             }
+        }
 
-            return not visited.contains(pos);
-        };
+        const auto middle = Coordinate{.row = grid.rows(), .col = grid.cols()} * (TILES / 2);
+        tiled[find_start_point(grid) + middle] = 'S';
+        return tiled;
+    }
 
-        auto queue = std::queue<std::pair<std::size_t, Coordinate>>{};
-        queue.emplace(0, find_start_point(grid));
-        while (not queue.empty()) {
-            const auto [distance, coord] = queue.front();
-            queue.pop();
+    // What the fit relies on: an odd square with the start in its centre and clear middle lines and border, so that
+    // every copy of the garden is entered at its corners or in the middle of its sides.
+    auto check_published_shape(const Grid& grid) -> void {
+        if (grid.rows() != grid.cols()) {
+            throw std::invalid_argument(std::format("The garden is {} x {}, not square", grid.rows(), grid.cols()));
+        }
 
-            if (!visited.contains(coord)) {
-                visited.emplace(coord, distance);
+        const auto side   = grid.rows();
+        const auto middle = side / 2;
+        if (side % 2 == 0 || find_start_point(grid) != Coordinate{.row = middle, .col = middle}) {
+            throw std::invalid_argument("The start is not in the centre of the garden");
+        }
 
-                for (const auto& dir : std::vector<Coordinate>{{-1, 0}, {1, 0}, {0, -1}, {0, 1}}) {
-                    if (const auto next = coord + dir; can_step(next)) {
-                        queue.emplace(distance + 1, next);
-                    }
+        for (auto index = Grid::Index{0}; index != side; index++) {
+            for (const auto& cell : {Coordinate{.row = middle, .col = index}, Coordinate{.row = index, .col = middle},
+                                     Coordinate{.row = 0, .col = index}, Coordinate{.row = side - 1, .col = index},
+                                     Coordinate{.row = index, .col = 0}, Coordinate{.row = index, .col = side - 1}}) {
+                if (grid[cell] == '#') {
+                    throw std::invalid_argument("The middle lines and the border of the garden have to be clear");
                 }
             }
         }
-
-        return visited;
-    }
-
-    auto count_reachable_plots(const Grid& grid, std::size_t steps) -> std::size_t {
-        const auto visited = find_all_reachable_coorditates(grid);
-        return std::ranges::count_if(visited | std::views::values, [steps](auto distance) {
-            return distance <= steps and distance % 2 == 0;
-        });
     }
 
+    // On gardens shaped like the published ones the plots reached after `half + k * size` steps grow quadratically
+    // in k. The parabola goes through the exact counts for k = 0, 1, 2, which a walk on the tiled garden finds.
     auto count_reachable_plots_on_infinitive_grid(const Grid& grid, std::size_t steps) -> std::size_t {
-        // for more details go to
-        //   - https://www.reddit.com/r/adventofcode/comments/18nol3m/2023_day_21_a_geometric_solutionexplanation_for/
-        //   - https://github.com/villuna/aoc23/wiki/A-Geometric-solution-to-advent-of-code-2023,-day-21
+        check_published_shape(grid);
+
+        const auto size   = static_cast<std::size_t>(grid.rows());
+        const auto half   = size / 2;
+        const auto counts = count_plots_by_distance(tile_garden(grid));
 
-        const auto visited = find_all_reachable_coorditates(grid);
+        // the walk doesn't leave the tiled garden yet, so its counts are exact
+        if (steps <= half + 2 * size) {
+            return count_reachable(counts, steps);
+        }
 
-        // clang-format off
-        const auto even_corners = std::ranges::count_if(visited | std::views::values, [](auto distance) { return distance % 2 == 0 && distance > 65; });
-        const auto odd_corners  = std::ranges::count_if(visited | std::views::values, [](auto distance) { return distance % 2 == 1 && distance > 65; });
-        const auto even_full    = std::ranges::count_if(visited | std::views::values, [](auto distance) { return distance % 2 == 0; });
-        const auto odd_full     = std::ranges::count_if(visited | std::views::values, [](auto distance) { return distance % 2 == 1; });
-        // clang-format on
+        // further out only the ring boundaries lie on the parabola
+        if ((steps - half) % size != 0) {
+            throw std::invalid_argument(std::format("{} steps don't end on a ring of gardens of side {}", steps, size));
+        }
 
-        const auto n      = (steps - (grid.size() / 2)) / grid.size();
-        const auto answer = ((n + 1) * (n + 1)) * odd_full + (n * n) * even_full - (n + 1) * odd_corners + n * even_corners;
+        const auto reached = [&](std::size_t rings) {
+            return static_cast<std::int64_t>(count_reachable(counts, half + rings * size));
+        };
+        const auto first  = reached(0);
+        const auto second = reached(1);
+        const auto third  = reached(2);
 
-        return answer;
+        // Newton's forward differences
+        const auto n = static_cast<std::int64_t>((steps - half) / size);
+        return static_cast<std::size_t>(first + n * (second - first) + n * (n - 1) / 2 * (third - 2 * second + first));
     }
-
 }  // namespace
 
-int main() {
-    const auto path   = std::filesystem::path{"input.data"};
-    const auto data   = core::io::read_file(path, true);
-    const auto garden = core::strings::split(core::strings::strip(data), "\n");
 
-    const auto step_count = 64ul;
-    const auto plot_count = count_reachable_plots(garden, step_count);
-    std::cout << std::format("The Elf could read {} plots in exactly {} steps\n", plot_count, step_count);
+namespace day_21 {
+    auto parse(std::string_view input) -> Grid {
+        return Grid::parse(input, 1, '#');
+    }
 
-    const auto new_step_count = 26'501'365ul;
-    const auto new_plot_count = count_reachable_plots_on_infinitive_grid(garden, new_step_count);
-    std::cout << std::format("The Elf could read {} plots in exactly {} steps\n", new_plot_count, new_step_count);
+    auto part_one(const Grid& garden, std::size_t steps) -> std::size_t {
+        return count_reachable_plots(garden, steps);
+    }
+
+    auto part_two(const Grid& garden, std::size_t steps) -> std::size_t {
+        return count_reachable_plots_on_infinitive_grid(garden, steps);
+    }
 
-    return 0;
-}
+    auto solve(std::string_view input) -> core::Answers {
+        const auto garden = parse(input);
+        return {std::format("{}", part_one(garden)), std::format("{}", part_two(garden))};
+    }
+}  // namespace day_21
@@ -0,0 +1,23 @@
+#ifndef STEP_COUNTER_HXX
+#define STEP_COUNTER_HXX
+
+#include <core/grid.hxx>
+#include <core/solution.hxx>
+
+#include <cstddef>
+#include <string_view>
+
+
+namespace day_21 {
+    using Grid = core::Grid2D<char>;
+
+    constexpr auto STEPS          = 64ul;
+    constexpr auto INFINITE_STEPS = 26'501'365ul;
+
+    auto parse(std::string_view input) -> Grid;
+    auto part_one(const Grid& garden, std::size_t steps = STEPS) -> std::size_t;
+    auto part_two(const Grid& garden, std::size_t steps = INFINITE_STEPS) -> std::size_t;
+    auto solve(std::string_view input) -> core::Answers;
+}  // namespace day_21
+
+#endif  // STEP_COUNTER_HXX
@@ -1,11 +1,12 @@
+#include "gear-ratios.hxx"
+
 #include <core/numbers.hxx>
+#include <core/strings.hxx>
 
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <format>
-#include <fstream>
-#include <iostream>
 #include <map>
 #include <numeric>
 #include <set>
@@ -16,7 +17,7 @@
 
 
 namespace {
-    using Schema      = std::vector<std::string>;
+    using day_3::Schema;
     using Coordinate  = std::tuple<std::size_t, std::size_t>;
     using PartNumbers = std::vector<std::uint32_t>;
     using Parts       = std::map<Coordinate, PartNumbers>;
@@ -26,18 +27,6 @@ namespace {
     const auto     NON_SYMBOLS = std::set<char>{'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '.'};
 
 
-    auto load_engine_schematic(const std::string& path) -> Schema {
-        auto schema = Schema{};
-
-        std::string   line;
-        std::ifstream stream{path};
-        while (std::getline(stream, line)) {
-            schema.emplace_back(line);
-        }
-
-        return schema;
-    }
-
     auto find_next_number(std::string_view str, std::size_t offset) -> std::tuple<std::string_view, std::size_t> {
         const auto start = str.find_first_of(DIGITS, offset);
         if (start == std::string_view::npos) {
@@ -113,22 +102,27 @@ namespace {
 }  // namespace
 
 
-auto main() -> int {
-    try {
-        const auto schema = load_engine_schematic("input.data");
+namespace day_3 {
+    auto parse(std::string_view input) -> Schema {
+        auto schema = Schema{};
+        for (const auto line : core::strings::split_view(core::strings::strip(input, "\n"), "\n")) {
+            schema.emplace_back(line);
+        }
+        return schema;
+    }
 
-        const auto parts            = get_parts(schema);
-        const auto part_numbers     = get_part_numbers(parts);
-        const auto part_numbers_sum = std::reduce(part_numbers.cbegin(), part_numbers.cend());
-        std::cout << std::format("The sum of part numbers in the engine schematic is {}\n", part_numbers_sum);
+    auto part_one(const Schema& schema) -> std::uint64_t {
+        const auto part_numbers = get_part_numbers(get_parts(schema));
+        return std::reduce(part_numbers.cbegin(), part_numbers.cend(), std::uint64_t{0});
+    }
 
-        const auto gear_ratios     = get_gear_ratios(schema, parts);
-        const auto gear_ratios_sum = std::reduce(gear_ratios.cbegin(), gear_ratios.cend());
-        std::cout << std::format("The sum of gear ratios in the engine schematic is {}\n", gear_ratios_sum);
-    } catch (const std::exception& ex) {  // NOLINT: std::exception if fine here
-        std::cerr << std::format("Critical error: {}\n", ex.what());
-        return 1;
+    auto part_two(const Schema& schema) -> std::uint64_t {
+        const auto gear_ratios = get_gear_ratios(schema, get_parts(schema));
+        return std::reduce(gear_ratios.cbegin(), gear_ratios.cend(), std::uint64_t{0});
     }
 
-    return 0;
-}
+    auto solve(std::string_view input) -> core::Answers {
+        const auto schema = parse(input);
+        return {std::format("{}", part_one(schema)), std::format("{}", part_two(schema))};
+    }
+}  // namespace day_3
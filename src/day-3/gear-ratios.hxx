@@ -0,0 +1,21 @@
+#ifndef GEAR_RATIOS_HXX
+#define GEAR_RATIOS_HXX
+
+#include <core/solution.hxx>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace day_3 {
+    using Schema = std::vector<std::string>;
+
+    auto parse(std::string_view input) -> Schema;
+    auto part_one(const Schema& schema) -> std::uint64_t;
+    auto part_two(const Schema& schema) -> std::uint64_t;
+    auto solve(std::string_view input) -> core::Answers;
+}  // namespace day_3
+
+#endif  // GEAR_RATIOS_HXX
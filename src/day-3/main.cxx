@@ -0,0 +1,27 @@
+#include "gear-ratios.hxx"
+
+#include <core/io.hxx>
+
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+auto main() -> int {
+    try {
+        const auto data   = core::io::MappedFile{std::filesystem::path{"input.data"}};
+        const auto schema = day_3::parse(data.view());
+
+        const auto part_numbers_sum = day_3::part_one(schema);
+        std::cout << std::format("The sum of part numbers in the engine schematic is {}\n", part_numbers_sum);
+
+        const auto gear_ratios_sum = day_3::part_two(schema);
+        std::cout << std::format("The sum of gear ratios in the engine schematic is {}\n", gear_ratios_sum);
+    } catch (const std::exception& ex) {  // NOLINT: std::exception if fine here
+        std::cerr << std::format("Critical error: {}\n", ex.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,27 @@
+#include "scratchcards.hxx"
+
+#include <core/io.hxx>
+
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+auto main() -> int {
+    try {
+        const auto data  = core::io::MappedFile{std::filesystem::path{"input.data"}};
+        const auto cards = day_4::parse(data.view());
+
+        const auto total_points = day_4::part_one(cards);
+        std::cout << std::format("The total points worth is {}\n", total_points);
+
+        const auto scratchcards = day_4::part_two(cards);
+        std::cout << std::format("The total amount of scratchcards is {}\n", scratchcards);
+    } catch (const std::exception& ex) {  // NOLINT: std::exception if fine here
+        std::cerr << std::format("Critical error: {}\n", ex.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -1,141 +1,205 @@
+#include "scratchcards.hxx"
+
+#include <core/arena.hxx>
+#include <core/cache.hxx>
+#include <core/io.hxx>
 #include <core/numbers.hxx>
+#include <core/parallel.hxx>
+#include <core/strings.hxx>
 
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <format>
-#include <fstream>
-#include <iostream>
 #include <iterator>
+#include <memory_resource>
 #include <numeric>
-#include <stdexcept>
-#include <string>
+#include <span>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
 
 
 namespace {
+    using day_4::Card;
+    using day_4::Cards;
+
+    // bumped whenever the serialized cards change
+    constexpr auto CACHE_SCHEMA = std::uint32_t{1};
+
+
     auto make_subview(std::string_view source, char symbol) -> std::string_view {
         const auto symbol_position = source.find(symbol);
         return source.substr(0, symbol_position);
     }
 
 
-    struct Card {
-    public:
-        static auto load(std::string_view record) -> Card {
-            auto card = Card{};
-
-            // Card 1: 41 48 83 86 17 | 83 86  6 31 17  9 48 53
-            record.remove_prefix(4);  // Remove "Card"
+    auto calculate_game_result(const Cards& cards) -> std::uint32_t {
+        auto counter = std::pmr::unordered_map<std::uint32_t, std::uint32_t>{core::memory_resource()};
 
-            // extract id
-            const auto id = make_subview(record, ':');
-            card.id_      = core::numbers::parse<std::uint32_t>(id);
-            record.remove_prefix(id.size() + 1);
+        const auto copy_cards = [&](std::size_t id, std::size_t count, std::size_t multiplier) {
+            const auto max_id = cards.size() + 1;
+            while (id != max_id && count != 0) {
+                counter[id] += multiplier;
+                id++;
+                count--;
+            }
+        };
 
-            // read winning numbers
-            const auto winning_numbers = make_subview(record, '|');
-            card.winning_numbers_      = core::numbers::parse_numbers<std::uint32_t>(winning_numbers);
-            std::ranges::sort(card.winning_numbers_);
-            record.remove_prefix(winning_numbers.size() + 1);
+        for (const auto& card : cards) {
+            const auto& matches = card.get_matches();
+            counter[card.id()]++;
+            copy_cards(card.id() + 1, matches.size(), counter[card.id()]);
+        }
 
-            // read draft numbers
-            card.draft_numbers_ = core::numbers::parse_numbers<std::uint32_t>(record);
-            std::ranges::sort(card.draft_numbers_);
+        // std::accumulate, the fold of std::reduce would have to take two map entries as well
+        return std::accumulate(
+            counter.cbegin(), counter.cend(), std::uint32_t{0},
+            [](std::uint32_t stored, const auto& entry) { return stored + entry.second; }
+        );
+    }
 
-            return card;
+    auto save(const Cards& cards, core::cache::Writer& writer) -> void {
+        writer.write(cards.size());
+        for (const auto& card : cards) {
+            card.save(writer);
         }
+    }
 
-        auto id() const -> std::uint32_t {
-            return id_;
-        }
+    auto load(core::cache::Reader& reader) -> Cards {
+        auto cards = Cards{core::memory_resource()};
 
-        auto get_points() const -> std::uint32_t {
-            return (1 << (get_matches().size() - 1));
+        const auto count = reader.read<std::size_t>();
+        cards.reserve(count);
+        for (auto index = 0ul; index != count; index++) {
+            cards.emplace_back(Card::restore(reader));
         }
+        return cards;
+    }
+}  // namespace
 
-        auto get_matches() const -> const std::vector<std::uint32_t>& {
-            if (matches_.empty()) {
-                std::set_intersection(
-                    winning_numbers_.cbegin(), winning_numbers_.cend(), draft_numbers_.cbegin(), draft_numbers_.cend(),
-                    std::back_inserter(matches_)
-                );
-            }
-            return matches_;
-        }
 
-    private:
-        std::uint32_t                      id_{0};
-        std::vector<std::uint32_t>         winning_numbers_;
-        std::vector<std::uint32_t>         draft_numbers_;
-        mutable std::vector<std::uint32_t> matches_;
-    };
+namespace day_4 {
+    auto Card::load(std::string_view record) -> Card {
+        auto card = Card{};
 
+        // Card 1: 41 48 83 86 17 | 83 86  6 31 17  9 48 53
+        record.remove_prefix(4);  // Remove "Card"
 
-    auto load_cards(const std::string& path) -> std::vector<Card> {
-        std::ifstream file{path};
-        if (!file.is_open()) {
-            throw std::runtime_error("Failed to open file: " + path);
-        }
+        // extract id
+        const auto id = make_subview(record, ':');
+        card.id_      = core::numbers::parse<std::uint32_t>(id);
+        record.remove_prefix(id.size() + 1);
 
-        std::vector<Card> cards;
+        // read winning numbers
+        const auto winning_numbers = make_subview(record, '|');
+        core::numbers::parse_numbers_into(winning_numbers, card.winning_numbers_);
+        std::ranges::sort(card.winning_numbers_);
+        record.remove_prefix(winning_numbers.size() + 1);
 
-        std::string record;
-        while (std::getline(file, record)) {
-            cards.emplace_back(Card::load(record));
-        }
+        // read draft numbers
+        core::numbers::parse_numbers_into(record, card.draft_numbers_);
+        std::ranges::sort(card.draft_numbers_);
 
-        return cards;
+        card.match();
+        return card;
+    }
+
+    auto Card::restore(core::cache::Reader& reader) -> Card {
+        auto card = Card{};
+        card.id_  = reader.read<std::uint32_t>();
+
+        const auto winning_numbers = reader.read_span<std::uint32_t>();
+        card.winning_numbers_.assign(winning_numbers.begin(), winning_numbers.end());
+
+        const auto draft_numbers = reader.read_span<std::uint32_t>();
+        card.draft_numbers_.assign(draft_numbers.begin(), draft_numbers.end());
+
+        card.match();
+        return card;
     }
 
-    auto get_cards_points(const std::vector<Card>& cards) -> std::vector<std::uint32_t> {
-        auto scores = std::vector<std::uint32_t>{};
-        std::ranges::transform(cards, std::back_inserter(scores), [](const Card& card) { return card.get_points(); });
-        return scores;
+    auto Card::save(core::cache::Writer& writer) const -> void {
+        writer.write(id_);
+        writer.write_span(std::span{winning_numbers_});
+        writer.write_span(std::span{draft_numbers_});
     }
 
-    auto calculate_game_result(const std::vector<Card>& cards) -> std::uint32_t {
-        auto counter = std::unordered_map<std::uint32_t, std::uint32_t>{};
+    auto Card::get_points() const -> std::uint32_t {
+        const auto matches = get_matches().size();
+        return matches == 0 ? 0 : (1u << (matches - 1));
+    }
 
-        const auto copy_cards = [&](std::size_t id, std::size_t count, std::size_t multiplier) {
-            const auto max_id = cards.size() + 1;
-            while (id != max_id && count != 0) {
-                counter[id] += multiplier;
-                id++;
-                count--;
-            }
-        };
+    auto Card::get_matches() const -> const std::pmr::vector<std::uint32_t>& {
+        return matches_;
+    }
 
-        for (const auto& card : cards) {
-            const auto& matches = card.get_matches();
-            counter[card.id()]++;
-            copy_cards(card.id() + 1, matches.size(), counter[card.id()]);
+    auto Card::match() -> void {
+        matches_.clear();
+        std::set_intersection(
+            winning_numbers_.cbegin(), winning_numbers_.cend(), draft_numbers_.cbegin(), draft_numbers_.cend(),
+            std::back_inserter(matches_)
+        );
+    }
+
+    auto parse(std::string_view input) -> Cards {
+        auto cards = Cards{core::memory_resource()};
+        for (const auto record : core::strings::split_view(input, "\n")) {
+            if (not record.empty()) {
+                cards.emplace_back(Card::load(record));
+            }
         }
+        return cards;
+    }
 
-        return std::reduce(counter.cbegin(), counter.cend(), std::uint32_t{0}, [&](std::uint32_t stored, const auto& entry) {
-            const auto [id, count] = entry;
-            return stored + count;
-        });
+    auto part_one(const Cards& cards) -> std::uint32_t {
+        return core::parallel::sum(cards, std::uint32_t{0}, [](const Card& card) { return card.get_points(); });
     }
-}  // namespace
 
+    auto part_two(const Cards& cards) -> std::uint32_t {
+        return calculate_game_result(cards);
+    }
+
+    auto solve(std::string_view input) -> core::Answers {
+        const auto cards = parse(input);
+        return {std::format("{}", part_one(cards)), std::format("{}", part_two(cards))};
+    }
+
+    auto solve_stream(core::io::LineReader& input) -> core::Answers {
+        auto points = std::uint32_t{0};
+        auto total  = std::uint32_t{0};
+
+        // copies won for the cards that follow the current one, a card can't win more than it has numbers
+        auto won = std::deque<std::uint32_t>{};
+        while (const auto record = input.next()) {
+            if (record->empty()) {
+                continue;
+            }
 
-auto main() -> int {
-    try {
-        const auto cards = load_cards("input.data");
+            const auto card = Card::load(*record);
+            points += card.get_points();
 
-        const auto cards_points = get_cards_points(cards);
-        const auto total_points = std::reduce(cards_points.cbegin(), cards_points.cend());
-        std::cout << std::format("The total points worth is {}\n", total_points);
+            auto copies = std::uint32_t{1};
+            if (not won.empty()) {
+                copies += won.front();
+                won.pop_front();
+            }
+            total += copies;
 
-        const auto scratchcards = calculate_game_result(cards);
-        std::cout << std::format("The total amount of scratchcards is {}\n", scratchcards);
-    } catch (const std::exception& ex) {  // NOLINT: std::exception if fine here
-        std::cerr << std::format("Critical error: {}\n", ex.what());
-        return 1;
+            const auto matches = card.get_matches().size();
+            if (won.size() < matches) {
+                won.resize(matches);
+            }
+            for (auto index = 0ul; index != matches; index++) {
+                won[index] += copies;
+            }
+        }
+        return {std::format("{}", points), std::format("{}", total)};
     }
 
-    return 0;
-}
+    auto solve_cached(std::string_view input, const core::cache::Store& store) -> core::Answers {
+        const auto cards = store.load_or_parse("day-4", CACHE_SCHEMA, input, parse, save, load);
+        return {std::format("{}", part_one(cards)), std::format("{}", part_two(cards))};
+    }
+}  // namespace day_4
@@ -0,0 +1,58 @@
+#ifndef SCRATCHCARDS_HXX
+#define SCRATCHCARDS_HXX
+
+#include <core/arena.hxx>
+#include <core/solution.hxx>
+
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+
+namespace core::cache {
+    class Reader;
+    class Store;
+    class Writer;
+}  // namespace core::cache
+
+
+namespace day_4 {
+    struct Card {
+    public:
+        static auto load(std::string_view record) -> Card;
+
+        // the parsed numbers, as written by `save`
+        static auto restore(core::cache::Reader& reader) -> Card;
+        auto save(core::cache::Writer& writer) const -> void;
+
+        auto id() const -> std::uint32_t {
+            return id_;
+        }
+
+        auto get_points() const -> std::uint32_t;
+        auto get_matches() const -> const std::pmr::vector<std::uint32_t>&;
+
+    private:
+        // intersects the sorted numbers once they are read, so the getters stay read-only
+        auto match() -> void;
+
+    private:
+        // numbers live on the resource that was active when the card was loaded
+        std::uint32_t                   id_{0};
+        std::pmr::vector<std::uint32_t> winning_numbers_{core::memory_resource()};
+        std::pmr::vector<std::uint32_t> draft_numbers_{core::memory_resource()};
+        std::pmr::vector<std::uint32_t> matches_{core::memory_resource()};
+    };
+
+    using Cards = std::pmr::vector<Card>;
+
+    auto parse(std::string_view input) -> Cards;
+    auto part_one(const Cards& cards) -> std::uint32_t;
+    auto part_two(const Cards& cards) -> std::uint32_t;
+    auto solve(std::string_view input) -> core::Answers;
+    auto solve_stream(core::io::LineReader& input) -> core::Answers;
+    auto solve_cached(std::string_view input, const core::cache::Store& store) -> core::Answers;
+}  // namespace day_4
+
+#endif  // SCRATCHCARDS_HXX
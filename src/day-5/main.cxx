@@ -0,0 +1,21 @@
+#include "seed-fertilizer.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+auto main() -> int {
+    const auto data    = core::io::MappedFile{std::filesystem::path{"input.data"}};
+    const auto almanac = day_5::parse(data.view());
+
+    const auto closest_location = day_5::part_one(almanac);
+    std::cout << std::format("The result value is {}\n", closest_location);
+
+    const auto closest_range_location = day_5::part_two(almanac);
+    std::cout << std::format("The result value is {}\n", closest_range_location);
+
+    return 0;
+}
@@ -1,228 +1,191 @@
-#include <core/io.hxx>
+#include "seed-fertilizer.hxx"
+
+#include <core/numbers.hxx>
+#include <core/strings.hxx>
 
 #include <algorithm>
-#include <cctype>
 #include <cstdint>
 #include <format>
-#include <fstream>
 #include <functional>
-#include <iostream>
 #include <iterator>
 #include <ranges>
+#include <span>
 #include <stdexcept>
-#include <string>
+#include <string_view>
 #include <vector>
 
 
 namespace {
-    struct Range {
-        std::uint64_t input_offset  = 0;
-        std::uint64_t output_offset = 0;
-        std::uint64_t size          = 0;
-
-        auto operator<(const Range& other) const -> bool {
-            return input_offset < other.input_offset;
-        }
+    using day_5::Almanac;
+    using day_5::Range;
 
-        friend auto operator>>(std::istream& stream, Range& range) -> std::istream& {
-            return stream >> range.output_offset >> range.input_offset >> range.size;
-        }
-    };
 
     struct SeedRange {
         std::uint64_t start = 0;
         std::uint64_t size  = 0;
 
-        auto operator<(const SeedRange& other) const -> bool {
-            return start < other.start;
+        static constexpr auto FIELDS = 2ul;
+
+        static auto from(std::span<const std::uint64_t> fields) -> SeedRange {
+            return {.start = fields[0], .size = fields[1]};
         }
 
-        friend auto operator>>(std::istream& stream, SeedRange& range) -> std::istream& {
-            return stream >> range.start >> range.size;
+        auto operator<(const SeedRange& other) const -> bool {
+            return start < other.start;
         }
     };
 
-    struct Mapper {
-        std::vector<std::uint64_t> seeds;
-        std::vector<Range>         seed_to_soil;
-        std::vector<Range>         soil_to_fertilizer;
-        std::vector<Range>         fertilizer_to_water;
-        std::vector<Range>         water_to_light;
-        std::vector<Range>         light_to_temperature;
-        std::vector<Range>         temperature_to_humidity;
-        std::vector<Range>         humidity_to_location;
-
-        friend std::istream& operator>>(std::istream& stream, Mapper& mapper) {
-            const auto drop_text = [&stream] {
-                while (std::isdigit(stream.peek()) == 0) {
-                    stream.ignore();
-                }
-            };
-
-            const auto read_part = [&stream, &drop_text]<typename T>(std::vector<T>& destination) {
-                drop_text();
-                destination = core::io::read_sequence<T>(stream);
-                std::ranges::sort(destination, std::less<>{});
-                stream.clear();
-            };
-
-            read_part(mapper.seeds);
-            read_part(mapper.seed_to_soil);
-            read_part(mapper.soil_to_fertilizer);
-            read_part(mapper.fertilizer_to_water);
-            read_part(mapper.water_to_light);
-            read_part(mapper.light_to_temperature);
-            read_part(mapper.temperature_to_humidity);
-            read_part(mapper.humidity_to_location);
-
-            return stream;
+    template<typename T>
+    auto make_records(std::span<const std::uint64_t> numbers) -> std::vector<T> {
+        auto records = std::vector<T>{};
+        records.reserve(numbers.size() / T::FIELDS);
+        for (auto fields = numbers; fields.size() >= T::FIELDS; fields = fields.subspan(T::FIELDS)) {
+            records.push_back(T::from(fields));
         }
 
-        static auto convert(std::uint64_t input, const std::vector<Range>& mapper) -> std::uint64_t {
-            auto it = std::ranges::upper_bound(mapper, Range{input, 0, 0}, std::less<>{});
+        std::ranges::sort(records, std::less<>{});
+        return records;
+    }
 
-            // If there is none, then no conversion
-            if (it == mapper.begin()) {
-                return input;
-            }
-            it = std::prev(it);
+    // Parses the numbers of one almanac section (everything after its "...:" header).
+    // `numbers` is a scratch buffer shared between the sections.
+    auto read_numbers(std::string_view section, std::vector<std::uint64_t>& numbers) -> std::vector<std::uint64_t>& {
+        numbers.clear();
+        core::numbers::parse_numbers_into(section.substr(section.find(':') + 1), numbers);
+        return numbers;
+    }
 
-            // If we are outside the bounds of the relevant mapping, then no conversion
-            if ((input - it->input_offset) > it->size) {
-                return input;
+    // Sections are separated by blank lines. Lines are stripped before they are tested, so "\r\n\r\n" is a break too.
+    auto split_sections(std::string_view input) -> std::vector<std::string_view> {
+        auto sections = std::vector<std::string_view>{};
+        auto start    = std::string_view::npos;  // first line of the open section
+        auto end      = std::size_t{0};          // past its last line
+        for (const auto line : core::strings::split_view(input, "\n")) {
+            const auto offset = static_cast<std::size_t>(line.data() - input.data());
+            if (not core::strings::strip(line).empty()) {
+                start = std::min(start, offset);
+                end   = offset + line.size();
+            } else if (start != std::string_view::npos) {
+                sections.push_back(input.substr(start, end - start));
+                start = std::string_view::npos;
             }
-
-            return (input - it->input_offset) + it->output_offset;
         }
-
-        [[nodiscard]] auto seed_to_location(std::uint64_t seed) const -> std::uint64_t {
-            const auto soil        = convert(seed, seed_to_soil);
-            const auto fertilizer  = convert(soil, soil_to_fertilizer);
-            const auto water       = convert(fertilizer, fertilizer_to_water);
-            const auto light       = convert(water, water_to_light);
-            const auto temperature = convert(light, light_to_temperature);
-            const auto humidity    = convert(temperature, temperature_to_humidity);
-            return convert(humidity, humidity_to_location);
+        if (start != std::string_view::npos) {
+            sections.push_back(input.substr(start, end - start));
         }
-    };
+        return sections;
+    }
 
+    auto convert(std::uint64_t input, const std::vector<Range>& mapper) -> std::uint64_t {
+        auto it = std::ranges::upper_bound(mapper, Range{input, 0, 0}, std::less<>{});
 
-    struct RangeMapper {
-        std::vector<SeedRange> seeds;
-        std::vector<Range>     seed_to_soil;
-        std::vector<Range>     soil_to_fertilizer;
-        std::vector<Range>     fertilizer_to_water;
-        std::vector<Range>     water_to_light;
-        std::vector<Range>     light_to_temperature;
-        std::vector<Range>     temperature_to_humidity;
-        std::vector<Range>     humidity_to_location;
-
-        friend std::istream& operator>>(std::istream& stream, RangeMapper& mapper) {
-            const auto drop_text = [&stream] {
-                while (std::isdigit(stream.peek()) == 0) {
-                    stream.ignore();
-                }
-            };
-
-            const auto read_part = [&stream, &drop_text]<typename T>(std::vector<T>& destination) {
-                drop_text();
-                destination = core::io::read_sequence<T>(stream);
-                std::ranges::sort(destination, std::less<>{});
-                stream.clear();
-            };
-
-            read_part(mapper.seeds);
-            read_part(mapper.seed_to_soil);
-            read_part(mapper.soil_to_fertilizer);
-            read_part(mapper.fertilizer_to_water);
-            read_part(mapper.water_to_light);
-            read_part(mapper.light_to_temperature);
-            read_part(mapper.temperature_to_humidity);
-            read_part(mapper.humidity_to_location);
-
-            return stream;
+        // If there is none, then no conversion
+        if (it == mapper.begin()) {
+            return input;
         }
+        it = std::prev(it);
 
-        static auto convert(const std::vector<SeedRange>& input, const std::vector<Range>& map) -> std::vector<SeedRange> {
-            auto it = std::ranges::upper_bound(map, Range{input[0].start, 0, 0}, std::less<>{});
-            if (it != map.begin()) {
-                it = std::prev(it);
-            }
-
-            // For each seed range in the input (the ranges are already sorted)
-            std::vector<SeedRange> output;
-            for (auto [start, size] : input) {
-                while (size > 0) {
-                    if (it == map.end()) {
-                        // No conversion, no more mappings
-                        output.push_back({start, size});
-                        size = 0;
-                    } else if (start < it->input_offset) {
-                        // No conversion
-                        // (initial part of the range not covered by a mapping)
-                        const auto actual = std::min(size, it->input_offset - start);
-                        output.push_back({start, actual});
-                        start += actual;
-                        size -= actual;
-                    } else if ((start - it->input_offset) >= it->size) {
-                        // The current mapping is no longer relevant
-                        ++it;
-                    } else {
-                        // Actual conversion
-                        const auto actual = std::min((it->input_offset + it->size) - start, size);
-                        output.push_back({start - it->input_offset + it->output_offset, actual});
-                        start += actual;
-                        size -= actual;
-                    }
-                }
-            }
-            std::ranges::sort(output, std::less<>{});
-            return output;
+        // If we are outside the bounds of the relevant mapping, then no conversion
+        if ((input - it->input_offset) > it->size) {
+            return input;
         }
 
-        [[nodiscard]] auto all_seed_locations() const -> std::vector<SeedRange> {
-            const auto soil        = convert(seeds, seed_to_soil);
-            const auto fertilizer  = convert(soil, soil_to_fertilizer);
-            const auto water       = convert(fertilizer, fertilizer_to_water);
-            const auto light       = convert(water, water_to_light);
-            const auto temperature = convert(light, light_to_temperature);
-            const auto humidity    = convert(temperature, temperature_to_humidity);
-            return convert(humidity, humidity_to_location);
+        return (input - it->input_offset) + it->output_offset;
+    }
+
+    auto seed_to_location(const Almanac& almanac, std::uint64_t seed) -> std::uint64_t {
+        const auto soil        = convert(seed, almanac.seed_to_soil);
+        const auto fertilizer  = convert(soil, almanac.soil_to_fertilizer);
+        const auto water       = convert(fertilizer, almanac.fertilizer_to_water);
+        const auto light       = convert(water, almanac.water_to_light);
+        const auto temperature = convert(light, almanac.light_to_temperature);
+        const auto humidity    = convert(temperature, almanac.temperature_to_humidity);
+        return convert(humidity, almanac.humidity_to_location);
+    }
+
+
+    auto convert(const std::vector<SeedRange>& input, const std::vector<Range>& map) -> std::vector<SeedRange> {
+        auto it = std::ranges::upper_bound(map, Range{input[0].start, 0, 0}, std::less<>{});
+        if (it != map.begin()) {
+            it = std::prev(it);
         }
-    };
 
-    auto find_closest_location(const std::string& path) -> std::uint64_t {
-        auto       stream = std::ifstream{path};
-        const auto mapper = core::io::read<Mapper>(stream);
-        if (not stream) {
-            throw std::runtime_error("Failed to parse");
+        // For each seed range in the input (the ranges are already sorted)
+        std::vector<SeedRange> output;
+        for (auto [start, size] : input) {
+            while (size > 0) {
+                if (it == map.end()) {
+                    // No conversion, no more mappings
+                    output.push_back({start, size});
+                    size = 0;
+                } else if (start < it->input_offset) {
+                    // No conversion
+                    // (initial part of the range not covered by a mapping)
+                    const auto actual = std::min(size, it->input_offset - start);
+                    output.push_back({start, actual});
+                    start += actual;
+                    size -= actual;
+                } else if ((start - it->input_offset) >= it->size) {
+                    // The current mapping is no longer relevant
+                    ++it;
+                } else {
+                    // Actual conversion
+                    const auto actual = std::min((it->input_offset + it->size) - start, size);
+                    output.push_back({start - it->input_offset + it->output_offset, actual});
+                    start += actual;
+                    size -= actual;
+                }
+            }
         }
+        std::ranges::sort(output, std::less<>{});
+        return output;
+    }
 
-        return std::ranges::min(mapper.seeds | std::views::transform([&mapper](std::uint64_t seed) {
-                                    return mapper.seed_to_location(seed);
-                                }));
+    auto all_seed_locations(const Almanac& almanac, const std::vector<SeedRange>& seeds) -> std::vector<SeedRange> {
+        const auto soil        = convert(seeds, almanac.seed_to_soil);
+        const auto fertilizer  = convert(soil, almanac.soil_to_fertilizer);
+        const auto water       = convert(fertilizer, almanac.fertilizer_to_water);
+        const auto light       = convert(water, almanac.water_to_light);
+        const auto temperature = convert(light, almanac.light_to_temperature);
+        const auto humidity    = convert(temperature, almanac.temperature_to_humidity);
+        return convert(humidity, almanac.humidity_to_location);
     }
+}  // namespace
 
-    auto find_closest_range_location(const std::string& path) -> std::uint64_t {
-        auto       stream = std::ifstream{path};
-        const auto mapper = core::io::read<RangeMapper>(stream);
-        if (not stream) {
+
+namespace day_5 {
+    auto parse(std::string_view input) -> Almanac {
+        auto numbers  = std::vector<std::uint64_t>{};
+        const auto sections = split_sections(input);
+        if (sections.size() != 8) {  // NOLINT: seeds and seven maps
             throw std::runtime_error("Failed to parse");
         }
 
-        return mapper.all_seed_locations().front().start;
+        auto almanac                    = Almanac{};
+        almanac.seeds                   = read_numbers(sections[0], numbers);
+        almanac.seed_to_soil            = make_records<Range>(read_numbers(sections[1], numbers));
+        almanac.soil_to_fertilizer      = make_records<Range>(read_numbers(sections[2], numbers));
+        almanac.fertilizer_to_water     = make_records<Range>(read_numbers(sections[3], numbers));
+        almanac.water_to_light          = make_records<Range>(read_numbers(sections[4], numbers));
+        almanac.light_to_temperature    = make_records<Range>(read_numbers(sections[5], numbers));
+        almanac.temperature_to_humidity = make_records<Range>(read_numbers(sections[6], numbers));
+        almanac.humidity_to_location    = make_records<Range>(read_numbers(sections[7], numbers));
+        return almanac;
     }
 
-}  // namespace
-
-auto main() -> int {
-    const auto input_path = std::string{"input.data"};
-
-    const auto closest_location = find_closest_location(input_path);
-    std::cout << std::format("The result value is {}\n", closest_location);
+    auto part_one(const Almanac& almanac) -> std::uint64_t {
+        return std::ranges::min(almanac.seeds | std::views::transform([&almanac](std::uint64_t seed) {
+                                    return seed_to_location(almanac, seed);
+                                }));
+    }
 
-    const auto closest_range_location = find_closest_range_location(input_path);
-    std::cout << std::format("The result value is {}\n", closest_range_location);
+    auto part_two(const Almanac& almanac) -> std::uint64_t {
+        const auto seeds = make_records<SeedRange>(almanac.seeds);
+        return all_seed_locations(almanac, seeds).front().start;
+    }
 
-    return 0;
-}
+    auto solve(std::string_view input) -> core::Answers {
+        const auto almanac = parse(input);
+        return {std::format("{}", part_one(almanac)), std::format("{}", part_two(almanac))};
+    }
+}  // namespace day_5
@@ -0,0 +1,46 @@
+#ifndef SEED_FERTILIZER_HXX
+#define SEED_FERTILIZER_HXX
+
+#include <core/solution.hxx>
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+
+namespace day_5 {
+    struct Range {
+        std::uint64_t input_offset  = 0;
+        std::uint64_t output_offset = 0;
+        std::uint64_t size          = 0;
+
+        static constexpr auto FIELDS = 3ul;
+
+        static auto from(std::span<const std::uint64_t> fields) -> Range {
+            return {.input_offset = fields[1], .output_offset = fields[0], .size = fields[2]};
+        }
+
+        auto operator<(const Range& other) const -> bool {
+            return input_offset < other.input_offset;
+        }
+    };
+
+    struct Almanac {
+        std::vector<std::uint64_t> seeds;
+        std::vector<Range>         seed_to_soil;
+        std::vector<Range>         soil_to_fertilizer;
+        std::vector<Range>         fertilizer_to_water;
+        std::vector<Range>         water_to_light;
+        std::vector<Range>         light_to_temperature;
+        std::vector<Range>         temperature_to_humidity;
+        std::vector<Range>         humidity_to_location;
+    };
+
+    auto parse(std::string_view input) -> Almanac;
+    auto part_one(const Almanac& almanac) -> std::uint64_t;
+    auto part_two(const Almanac& almanac) -> std::uint64_t;
+    auto solve(std::string_view input) -> core::Answers;
+}  // namespace day_5
+
+#endif  // SEED_FERTILIZER_HXX
@@ -0,0 +1,21 @@
+#include "wait-for-it.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+auto main() -> int {
+    const auto data  = core::io::MappedFile{std::filesystem::path{"input.data"}};
+    const auto races = day_6::parse(data.view());
+
+    const auto races_result = day_6::part_one(races);
+    std::cout << std::format("The result for multiple races is {}\n", races_result);
+
+    const auto race_result = day_6::part_two(races);
+    std::cout << std::format("The result for single races is {}\n", race_result);
+
+    return 0;
+}
@@ -1,14 +1,12 @@
+#include "wait-for-it.hxx"
+
 #include <core/io.hxx>
 #include <core/numbers.hxx>
 
-#include <algorithm>
-#include <cctype>
 #include <cmath>
 #include <cstdint>
 #include <format>
-#include <fstream>
-#include <iostream>
-#include <iterator>
+#include <spanstream>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -20,12 +18,12 @@ namespace {
         return core::numbers::parse_numbers<std::uint64_t>({record.data() + record.find(':') + 1});
     }
 
-    auto read_value(std::istream& stream) -> std::uint64_t {
-        const auto record = core::io::read_line(stream);
-
-        auto value = std::string{};
-        std::ranges::copy_if(record, std::back_inserter(value), [](char symbol) { return std::isdigit(symbol); });
-        return core::numbers::parse<std::uint64_t>(value);
+    auto concatenate(const std::vector<std::uint64_t>& values) -> std::uint64_t {
+        auto digits = std::string{};
+        for (const auto value : values) {
+            digits += std::to_string(value);
+        }
+        return core::numbers::parse<std::uint64_t>(digits);
     }
 
     auto count_ways_to_beat_record(std::uint64_t duration, std::uint64_t record) -> std::uint64_t {
@@ -45,38 +43,45 @@ namespace {
         return upper_bound - lower_bound + 1;
     }
 
-    auto get_races_result(const std::string& path) -> std::uint64_t {
-        auto stream = std::ifstream{path};
+}  // namespace
+
 
-        const auto durations = read_values(stream);
-        const auto distances = read_values(stream);
+namespace day_6 {
+    auto parse(std::string_view input) -> Races {
+        auto stream = std::ispanstream{input};
+
+        auto races      = Races{};
+        races.durations = read_values(stream);
+        races.distances = read_values(stream);
+        return races;
+    }
 
+    auto part_one(const Races& races) -> std::uint64_t {
         auto result = 1ul;
-        for (auto i = 0ul; i != durations.size(); i++) {
-            result *= count_ways_to_beat_record(durations[i], distances[i]);
+        for (auto i = 0ul; i != races.durations.size(); i++) {
+            result *= count_ways_to_beat_record(races.durations[i], races.distances[i]);
         }
         return result;
     }
 
-    auto get_race_result(const std::string& path) -> std::uint64_t {
-        auto stream = std::ifstream{path};
-
-        const auto duration = read_value(stream);
-        const auto distance = read_value(stream);
+    auto part_two(const Races& races) -> std::uint64_t {
+        const auto duration = concatenate(races.durations);
+        const auto distance = concatenate(races.distances);
 
         return count_ways_to_beat_record(duration, distance);
     }
 
-}  // namespace
-
-auto main() -> int {
-    const auto input_path = std::string{"input.data"};
-
-    const auto races_result = get_races_result(input_path);
-    std::cout << std::format("The result for multiple races is {}\n", races_result);
-
-    const auto race_result = get_race_result(input_path);
-    std::cout << std::format("The result for single races is {}\n", race_result);
+    auto solve(std::string_view input) -> core::Answers {
+        const auto races = parse(input);
+        return {std::format("{}", part_one(races)), std::format("{}", part_two(races))};
+    }
 
-    return 0;
-}
+    auto solve_stream(core::io::LineReader& input) -> core::Answers {
+        // just the two lines of the sheet, nothing worth streaming
+        auto sheet = std::string{};
+        while (const auto line = input.next()) {
+            sheet.append(*line).push_back('\n');
+        }
+        return solve(sheet);
+    }
+}  // namespace day_6
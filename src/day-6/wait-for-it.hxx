@@ -0,0 +1,24 @@
+#ifndef WAIT_FOR_IT_HXX
+#define WAIT_FOR_IT_HXX
+
+#include <core/solution.hxx>
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+
+namespace day_6 {
+    struct Races {
+        std::vector<std::uint64_t> durations;
+        std::vector<std::uint64_t> distances;
+    };
+
+    auto parse(std::string_view input) -> Races;
+    auto part_one(const Races& races) -> std::uint64_t;
+    auto part_two(const Races& races) -> std::uint64_t;
+    auto solve(std::string_view input) -> core::Answers;
+    auto solve_stream(core::io::LineReader& input) -> core::Answers;
+}  // namespace day_6
+
+#endif  // WAIT_FOR_IT_HXX
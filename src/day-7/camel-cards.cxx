@@ -1,16 +1,22 @@
+#include "camel-cards.hxx"
+
+#include <core/cache.hxx>
+#include <core/io.hxx>
 #include <core/numbers.hxx>
+#include <core/strings.hxx>
 
 #include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <format>
-#include <fstream>
 #include <functional>
-#include <iostream>
+#include <ranges>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 
@@ -169,6 +175,10 @@ namespace {
 
 
 namespace {
+    // bumped whenever the serialized records change
+    constexpr auto CACHE_SCHEMA = std::uint32_t{1};
+
+
     auto parse_hand(std::string_view hand_str, const Mapping& mapping) -> Hand {
         auto hand = Hand{};
         std::transform(hand_str.cbegin(), hand_str.cend(), hand.begin(), [&mapping](char card) { return mapping.at(card); });
@@ -176,16 +186,11 @@ namespace {
     }
 
     template<class Rules>
-    auto load_players(const std::string& path) -> std::vector<Player> {
+    auto make_players(const day_7::Records& records) -> std::vector<Player> {
         auto players = std::vector<Player>{};
-
-        auto stream = std::ifstream{path};
-        auto record = std::string{};
-        while (std::getline(stream, record)) {
-            const auto delimiter = record.find(' ');
-            const auto hand      = parse_hand({record.data(), delimiter}, Rules::MAPPING);
-            const auto bid       = core::numbers::parse<std::size_t>(record.data() + delimiter);
-            players.emplace_back(Player::create<Rules>(hand, bid));
+        players.reserve(records.size());
+        for (const auto& [hand, bid] : records) {
+            players.emplace_back(Player::create<Rules>(parse_hand(hand, Rules::MAPPING), bid));
         }
 
         std::ranges::sort(players, Rules::compare);
@@ -193,8 +198,8 @@ namespace {
     }
 
     template<class Rules>
-    auto get_total_score(const std::string& path) -> std::size_t {
-        const auto players = load_players<Rules>(path);
+    auto get_total_score(const day_7::Records& records) -> std::size_t {
+        const auto players = make_players<Rules>(records);
 
         auto result = 0ul;
         for (auto i = 0u; i != players.size(); i++) {
@@ -203,17 +208,143 @@ namespace {
 
         return result;
     }
+
+    // The rank of a record only depends on its hand, so a stream of records folds into one entry per possible
+    // hand: 13^5 of them however long the stream is. Equal hands are ranked in the order they arrive.
+    class HandTable {
+    public:
+        static constexpr auto LABELS = std::string_view{"23456789TJQKA"};
+        static constexpr auto SIZE   = 13ul * 13 * 13 * 13 * 13;
+
+        struct Entry {
+            std::size_t count    = 0;
+            std::size_t bids     = 0;
+            std::size_t weighted = 0;  // sum of every bid times the number of equal hands before it
+        };
+
+    public:
+        auto add(std::string_view hand, std::size_t bid) -> void {
+            if (hand.size() != HAND_SIZE) {
+                throw std::invalid_argument(std::format("Invalid hand {}", hand));
+            }
+
+            auto index = 0ul;
+            for (const auto card : hand) {
+                const auto label = LABELS.find(card);
+                if (label == std::string_view::npos) {
+                    throw std::invalid_argument(std::format("Invalid card {}", card));
+                }
+                index = index * LABELS.size() + label;
+            }
+
+            auto& entry = entries_[index];
+            entry.weighted += entry.count * bid;
+            entry.count++;
+            entry.bids += bid;
+        }
+
+        template<class Rules>
+        [[nodiscard]] auto total_score() const -> std::size_t {
+            auto ranked = std::vector<std::pair<Player, Entry>>{};
+            for (auto index = 0ul; index != SIZE; index++) {
+                if (entries_[index].count != 0) {
+                    const auto hand = parse_hand(decode(index), Rules::MAPPING);
+                    ranked.emplace_back(Player::create<Rules>(hand, entries_[index].bids), entries_[index]);
+                }
+            }
+            std::ranges::sort(ranked, Rules::compare, [](const auto& entry) -> const Player& { return entry.first; });
+
+            // the equal hands of an entry take ranks `rank + 1` to `rank + count`
+            auto result = 0ul;
+            auto rank   = 0ul;
+            for (const auto& [player, entry] : ranked) {
+                result += (rank + 1) * entry.bids + entry.weighted;
+                rank += entry.count;
+            }
+            return result;
+        }
+
+    private:
+        [[nodiscard]] static auto decode(std::size_t index) -> std::string {
+            auto hand = std::string(HAND_SIZE, ' ');
+            for (auto& card : hand | std::views::reverse) {
+                card = LABELS[index % LABELS.size()];
+                index /= LABELS.size();
+            }
+            return hand;
+        }
+
+    private:
+        std::vector<Entry> entries_ = std::vector<Entry>(SIZE);
+    };
+
+    auto save(const day_7::Records& records, core::cache::Writer& writer) -> void {
+        writer.write(records.size());
+        for (const auto& [hand, bid] : records) {
+            writer.write_string(hand);
+            writer.write(bid);
+        }
+    }
+
+    auto load(core::cache::Reader& reader) -> day_7::Records {
+        auto records = day_7::Records(reader.read<std::size_t>());
+        for (auto& [hand, bid] : records) {
+            hand = reader.read_string();
+            bid  = reader.read<std::size_t>();
+        }
+        return records;
+    }
 }  // namespace
 
 
-int main() {
-    const auto records_path = std::string{"input.data"};
+namespace day_7 {
+    auto parse(std::string_view input) -> Records {
+        auto records = Records{};
+        for (const auto record : core::strings::split_view(input, "\n")) {
+            if (record.empty()) {
+                continue;
+            }
+
+            const auto delimiter = record.find(' ');
+            records.push_back({
+                .hand = std::string{record.substr(0, delimiter)},
+                .bid  = core::numbers::parse<std::size_t>(record.substr(delimiter + 1)),
+            });
+        }
+        return records;
+    }
+
+    auto part_one(const Records& records) -> std::size_t {
+        return get_total_score<ClassicRules>(records);
+    }
+
+    auto part_two(const Records& records) -> std::size_t {
+        return get_total_score<JokerRules>(records);
+    }
 
-    const auto classic_score = get_total_score<ClassicRules>(records_path);
-    std::cout << std::format("The total score by classic rules is {}\n", classic_score);
+    auto solve(std::string_view input) -> core::Answers {
+        const auto records = parse(input);
+        return {std::format("{}", part_one(records)), std::format("{}", part_two(records))};
+    }
 
-    const auto joker_score = get_total_score<JokerRules>(records_path);
-    std::cout << std::format("The total score by rules with jokers is {}\n", joker_score);
+    auto solve_stream(core::io::LineReader& input) -> core::Answers {
+        auto table = HandTable{};
+        while (const auto record = input.next()) {
+            if (record->empty()) {
+                continue;
+            }
+
+            const auto delimiter = record->find(' ');
+            table.add(record->substr(0, delimiter), core::numbers::parse<std::size_t>(record->substr(delimiter + 1)));
+        }
+        return {
+            std::format("{}", table.total_score<ClassicRules>()),
+            std::format("{}", table.total_score<JokerRules>()),
+        };
+    }
 
-    return 0;
-}
+    auto solve_cached(std::string_view input, const core::cache::Store& store) -> core::Answers {
+        const auto records = store.load_or_parse("day-7", CACHE_SCHEMA, input, parse, save, load);
+        return {std::format("{}", part_one(records)), std::format("{}", part_two(records))};
+    }
+}  // namespace day_7
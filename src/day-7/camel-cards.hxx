@@ -0,0 +1,33 @@
+#ifndef CAMEL_CARDS_HXX
+#define CAMEL_CARDS_HXX
+
+#include <core/solution.hxx>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace core::cache {
+    class Store;
+}  // namespace core::cache
+
+
+namespace day_7 {
+    struct Record {
+        std::string hand;
+        std::size_t bid = 0;
+    };
+
+    using Records = std::vector<Record>;
+
+    auto parse(std::string_view input) -> Records;
+    auto part_one(const Records& records) -> std::size_t;
+    auto part_two(const Records& records) -> std::size_t;
+    auto solve(std::string_view input) -> core::Answers;
+    auto solve_stream(core::io::LineReader& input) -> core::Answers;
+    auto solve_cached(std::string_view input, const core::cache::Store& store) -> core::Answers;
+}  // namespace day_7
+
+#endif  // CAMEL_CARDS_HXX
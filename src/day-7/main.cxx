@@ -0,0 +1,21 @@
+#include "camel-cards.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto data    = core::io::MappedFile{std::filesystem::path{"input.data"}};
+    const auto records = day_7::parse(data.view());
+
+    const auto classic_score = day_7::part_one(records);
+    std::cout << std::format("The total score by classic rules is {}\n", classic_score);
+
+    const auto joker_score = day_7::part_two(records);
+    std::cout << std::format("The total score by rules with jokers is {}\n", joker_score);
+
+    return 0;
+}
@@ -1,78 +1,31 @@
-#include <core/io.hxx>
+#include "haunted-wasteland.hxx"
 
-#include <cctype>
+#include <core/scan.hxx>
+#include <core/strings.hxx>
+
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <format>
-#include <fstream>
-#include <iostream>
+#include <iterator>
 #include <numeric>
-#include <ranges>
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <tuple>
-#include <unordered_map>
-#include <unordered_set>
-#include <utility>
+#include <vector>
 
 
 namespace {
-    struct Node {
-        std::string name;
-        std::string left;
-        std::string right;
-    };
-
-    struct Graph {
-        enum class Direction : std::uint8_t {
-            Left,
-            Right,
-        };
-
-        [[nodiscard]] auto pick_next(const std::string& state, Direction direction) const -> std::string_view {
-            const auto& node = nodes.at(state);
-            return (direction == Direction::Left) ? node.left : node.right;
-        }
-
-        friend auto operator>>(std::istream& stream, Graph& graph) -> std::istream& {
-            const auto drop_irrelevant = [&] {
-                while (stream && (std::isupper(stream.peek()) == 0)) {
-                    stream.ignore();
-                }
-            };
+    using day_8::Graph;
+    using day_8::Label;
 
-            const auto get = [&] { return static_cast<char>(stream.get()); };
 
-            auto read_location = [&] {
-                drop_irrelevant();
-                return std::string{get(), get(), get()};
-            };
-
-            auto node = Node{};
-            while (not stream.eof()) {
-                node.name  = read_location();
-                node.left  = read_location();
-                node.right = read_location();
-
-                graph.nodes.emplace(node.name, node);
-
-                drop_irrelevant();
-            };
-
-            return stream;
+    auto find_node(const Graph& graph, std::string_view name) -> Label {
+        const auto label = graph.labels.find(name);
+        if (not label) {
+            throw std::runtime_error(std::format("There is no node {}", name));
         }
-
-        std::unordered_map<std::string, Node> nodes;
-    };
-
-    auto load_map(const std::string& path) -> std::tuple<std::string, Graph> {
-        auto stream = std::ifstream{path};
-
-        auto instructions = core::io::read<std::string>(stream);
-        auto graph        = core::io::read<Graph>(stream);
-
-        return {std::move(instructions), std::move(graph)};
+        return *label;
     }
 
     auto count_steps(const std::string& instructions, const Graph& graph) -> std::size_t {
@@ -80,8 +33,8 @@ namespace {
             return instructions[pos % instructions.size()] == 'L' ? Graph::Direction::Left : Graph::Direction::Right;
         };
 
-        const auto start = std::string{"AAA"};
-        const auto end   = std::string{"ZZZ"};
+        const auto start = find_node(graph, "AAA");
+        const auto end   = find_node(graph, "ZZZ");
 
         auto current = start;
         auto steps   = 0ul;
@@ -98,20 +51,22 @@ namespace {
             return instructions[pos % instructions.size()] == 'L' ? Graph::Direction::Left : Graph::Direction::Right;
         };
 
-        const auto get_node_names = [&graph](char letter) -> std::unordered_set<std::string> {
-            auto names_view = graph.nodes
-                            | std::views::transform([](const auto& node) -> const std::string& { return node.first; })
-                            | std::views::filter([letter](const std::string& name) { return name.back() == letter; });
+        const auto ends_with = [&graph](Label label, char letter) { return graph.labels.name(label).back() == letter; };
 
-            return std::unordered_set<std::string>{names_view.begin(), names_view.end()};
-        };
+        auto ends = std::vector<bool>(graph.nodes.size());
+        for (auto label = Label{0}; label != graph.nodes.size(); label++) {
+            ends[label] = ends_with(label, 'Z');
+        }
+
+        auto total_steps = std::uint64_t{1};
+        for (auto ghost = Label{0}; ghost != graph.nodes.size(); ghost++) {
+            if (not ends_with(ghost, 'A')) {
+                continue;
+            }
 
-        auto       total_steps = std::uint64_t{1};
-        const auto ends        = get_node_names('Z');
-        for (const auto& ghost : get_node_names('A')) {
             auto current = ghost;
             auto steps   = std::uint64_t{0};
-            while (!ends.contains(current)) {
+            while (!ends[current]) {
                 current = graph.pick_next(current, direction(steps));
                 steps++;
             }
@@ -140,15 +95,70 @@ namespace {
 }  // namespace
 
 
-int main() {
-    const auto path                  = std::string{"input.data"};
-    const auto [instructions, graph] = load_map(path);
+namespace day_8 {
+    auto Graph::load(std::string_view records) -> Graph {
+        auto graph = Graph{};
 
-    const auto steps = count_steps(instructions, graph);
-    std::cout << std::format("You need {} steps to get from AAA to ZZZ\n", steps);
+        const auto intern = [&graph](std::string_view name) { return graph.labels.intern(core::strings::strip(name)); };
 
-    const auto ghosts_steps = count_steps_with_ghosts(instructions, graph);
-    std::cout << std::format("It takes {} steps to only on nodes that end with Z\n", ghosts_steps);
+        auto defined = std::vector<bool>{};
+        for (const auto line : core::strings::split_view(records, "\n")) {
+            const auto record = core::strings::strip(line);
+            if (record.empty()) {
+                continue;
+            }
 
-    return 0;
-}
+            // AAA = (BBB, CCC)
+            const auto equals = core::scan::find(record, '=');
+            const auto open   = core::scan::find(record, '(', equals);
+            const auto comma  = core::scan::find(record, ',', open);
+            const auto close  = core::scan::find(record, ')', comma);
+            if (close == std::string_view::npos) {
+                throw std::runtime_error(std::format("Invalid node {}", record));
+            }
+
+            const auto label = intern(record.substr(0, equals));
+            const auto left  = intern(record.substr(open + 1, comma - open - 1));
+            const auto right = intern(record.substr(comma + 1, close - comma - 1));
+
+            graph.nodes.resize(graph.labels.size());
+            graph.nodes[label] = Node{.left = left, .right = right};
+
+            defined.resize(graph.labels.size());
+            defined[label] = true;
+        }
+
+        // every label has to be a node, the walks index `nodes` without checking
+        if (const auto missing = std::ranges::find(defined, false); missing != defined.end()) {
+            const auto label = static_cast<Label>(std::distance(defined.begin(), missing));
+            throw std::runtime_error(std::format("Node {} is never defined", graph.labels.name(label)));
+        }
+
+        return graph;
+    }
+
+    auto parse(std::string_view input) -> Map {
+        input = core::strings::strip(input);
+
+        // the instructions line, then the nodes
+        const auto end = std::min(core::scan::find(input, '\n'), input.size());
+
+        auto map         = Map{};
+        map.instructions = std::string{core::strings::strip(input.substr(0, end))};
+        map.graph        = Graph::load(input.substr(end));
+        return map;
+    }
+
+    auto part_one(const Map& map) -> std::size_t {
+        return count_steps(map.instructions, map.graph);
+    }
+
+    auto part_two(const Map& map) -> std::uint64_t {
+        return count_steps_with_ghosts(map.instructions, map.graph);
+    }
+
+    auto solve(std::string_view input) -> core::Answers {
+        const auto map = parse(input);
+        return {std::format("{}", part_one(map)), std::format("{}", part_two(map))};
+    }
+}  // namespace day_8
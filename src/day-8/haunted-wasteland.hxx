@@ -0,0 +1,51 @@
+#ifndef HAUNTED_WASTELAND_HXX
+#define HAUNTED_WASTELAND_HXX
+
+#include <core/interner.hxx>
+#include <core/solution.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace day_8 {
+    using Label = core::Interner::Id;
+
+    struct Node {
+        Label left  = 0;
+        Label right = 0;
+    };
+
+    struct Graph {
+        enum class Direction : std::uint8_t {
+            Left,
+            Right,
+        };
+
+        [[nodiscard]] auto pick_next(Label state, Direction direction) const -> Label {
+            const auto& node = nodes[state];
+            return (direction == Direction::Left) ? node.left : node.right;
+        }
+
+        // one `AAA = (BBB, CCC)` record per line
+        static auto load(std::string_view records) -> Graph;
+
+        core::Interner    labels;
+        std::vector<Node> nodes;  // indexed by label
+    };
+
+    struct Map {
+        std::string instructions;
+        Graph       graph;
+    };
+
+    auto parse(std::string_view input) -> Map;
+    auto part_one(const Map& map) -> std::size_t;
+    auto part_two(const Map& map) -> std::uint64_t;
+    auto solve(std::string_view input) -> core::Answers;
+}  // namespace day_8
+
+#endif  // HAUNTED_WASTELAND_HXX
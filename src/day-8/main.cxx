@@ -0,0 +1,21 @@
+#include "haunted-wasteland.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto data = core::io::MappedFile{std::filesystem::path{"input.data"}};
+    const auto map  = day_8::parse(data.view());
+
+    const auto steps = day_8::part_one(map);
+    std::cout << std::format("You need {} steps to get from AAA to ZZZ\n", steps);
+
+    const auto ghosts_steps = day_8::part_two(map);
+    std::cout << std::format("It takes {} steps to only on nodes that end with Z\n", ghosts_steps);
+
+    return 0;
+}
@@ -0,0 +1,20 @@
+#include "mirage-maintenance.hxx"
+
+#include <core/io.hxx>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+
+int main() {
+    const auto data      = core::io::MappedFile{std::filesystem::path{"input.data"}};
+    const auto histogram = day_9::parse(data.view());
+
+    const auto predictions_sum = day_9::part_one(histogram);
+    std::cout << std::format("the sum of these extrapolated values is {}\n", predictions_sum);
+
+    const auto backwards_predictions_sum = day_9::part_two(histogram);
+    std::cout << std::format("the sum of these backwards predictions is {}\n", backwards_predictions_sum);
+    return 0;
+}
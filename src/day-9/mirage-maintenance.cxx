@@ -1,84 +1,135 @@
+#include "mirage-maintenance.hxx"
+
+#include <core/cache.hxx>
+#include <core/generator.hxx>
+#include <core/io.hxx>
 #include <core/numbers.hxx>
+#include <core/parallel.hxx>
+#include <core/pipeline.hxx>
+#include <core/strings.hxx>
 
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <format>
-#include <fstream>
-#include <iostream>
 #include <iterator>
 #include <numeric>
 #include <ranges>
-#include <string>
+#include <span>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 
 namespace {
-    auto load_histogram(const std::string& path) -> std::vector<std::vector<std::int64_t>> {
-        auto stream = std::ifstream{path};
+    using day_9::Histogram;
 
-        auto histogram = std::vector<std::vector<std::int64_t>>{};
-        auto line      = std::string{};
-        while (std::getline(stream, line)) {
-            histogram.emplace_back(core::numbers::parse_numbers<std::int64_t>(line));
+    // bumped whenever the serialized histogram changes
+    constexpr auto CACHE_SCHEMA = std::uint32_t{1};
+
+
+    auto predict(const std::vector<std::int64_t>& sequence) -> std::int64_t {
+        auto tails = std::vector<std::int64_t>(1, sequence.back());
+
+        auto current   = sequence;
+        auto transform = std::views::transform([&](std::size_t i) { return current[i] - current[i - 1]; });
+        while (std::ranges::any_of(current, [](std::int64_t value) { return value != 0; })) {
+            auto next = std::vector<std::int64_t>{};
+            std::ranges::copy(std::views::iota(1ul, current.size()) | transform, std::back_inserter(next));
+            tails.push_back(next.back());
+            current = std::move(next);
         }
-        return histogram;
+        return std::reduce(tails.cbegin(), tails.cend());
     }
 
-    auto sum_of_predictions(const std::vector<std::vector<std::int64_t>>& histogram) -> std::int64_t {
-        const auto predict = [&](const std::vector<std::int64_t>& sequence) {
-            auto tails = std::vector<std::int64_t>(1, sequence.back());
-
-            auto current   = sequence;
-            auto transform = std::views::transform([&](std::size_t i) { return current[i] - current[i - 1]; });
-            while (std::ranges::any_of(current, [](std::int64_t value) { return value != 0; })) {
-                auto next = std::vector<std::int64_t>{};
-                std::ranges::copy(std::views::iota(1ul, current.size()) | transform, std::back_inserter(next));
-                tails.push_back(next.back());
-                current = std::move(next);
-            }
-            return std::reduce(tails.cbegin(), tails.cend());
-        };
+    auto predict_backwards(const std::vector<std::int64_t>& sequence) -> std::int64_t {
+        auto heads = std::vector<std::int64_t>(1, sequence.front());
+
+        auto current   = sequence;
+        auto transform = std::views::transform([&](std::size_t i) { return current[i] - current[i - 1]; });
+        while (std::ranges::any_of(current, [](std::int64_t value) { return value != 0; })) {
+            auto next = std::vector<std::int64_t>{};
+            std::ranges::copy(std::views::iota(1ul, current.size()) | transform, std::back_inserter(next));
+            heads.push_back(next.front());
+            current = std::move(next);
+        }
 
-        const auto predictions = histogram | std::views::transform(predict);
-        return std::reduce(predictions.begin(), predictions.end());
+        const auto reversed_heads = heads | std::views::reverse;
+        return std::reduce(
+            reversed_heads.begin(), reversed_heads.end(), std::int64_t{0},
+            [](std::int64_t acc, std::int64_t value) { return value - acc; }
+        );
     }
 
-    auto sum_of_backwards_predictions(const std::vector<std::vector<std::int64_t>>& histogram) -> std::int64_t {
-        const auto predict = [&](const std::vector<std::int64_t>& sequence) {
-            auto heads = std::vector<std::int64_t>(1, sequence.front());
-
-            auto current   = sequence;
-            auto transform = std::views::transform([&](std::size_t i) { return current[i] - current[i - 1]; });
-            while (std::ranges::any_of(current, [](std::int64_t value) { return value != 0; })) {
-                auto next = std::vector<std::int64_t>{};
-                std::ranges::copy(std::views::iota(1ul, current.size()) | transform, std::back_inserter(next));
-                heads.push_back(next.front());
-                current = std::move(next);
-            }
+    auto sum_of_predictions(const Histogram& histogram) -> std::int64_t {
+        return core::parallel::sum(histogram, std::int64_t{0}, predict);
+    }
+
+    auto sum_of_backwards_predictions(const Histogram& histogram) -> std::int64_t {
+        return core::parallel::sum(histogram, std::int64_t{0}, predict_backwards);
+    }
 
-            const auto reversed_heads = heads | std::views::reverse;
-            return std::reduce(
-                reversed_heads.begin(), reversed_heads.end(), std::int64_t{0},
-                [](std::int64_t acc, std::int64_t value) { return value - acc; }
-            );
-        };
+    auto save(const Histogram& histogram, core::cache::Writer& writer) -> void {
+        writer.write(histogram.size());
+        for (const auto& sequence : histogram) {
+            writer.write_span(std::span{sequence});
+        }
+    }
+
+    auto load(core::cache::Reader& reader) -> Histogram {
+        auto histogram = Histogram(reader.read<std::size_t>());
+        for (auto& sequence : histogram) {
+            const auto values = reader.read_span<std::int64_t>();
+            sequence.assign(values.begin(), values.end());
+        }
+        return histogram;
+    }
 
-        const auto predictions = histogram | std::views::transform(predict);
-        return std::reduce(predictions.begin(), predictions.end());
+    auto load_sequences(core::io::LineReader& input) -> core::Generator<std::vector<std::int64_t>> {
+        for (const auto record : core::io::records(input)) {
+            if (auto sequence = core::numbers::parse_numbers<std::int64_t>(record); not sequence.empty()) {
+                co_yield std::move(sequence);
+            }
+        }
     }
 }  // namespace
 
 
-int main() {
-    const auto path      = std::string{"input.data"};
-    const auto histogram = load_histogram(path);
+namespace day_9 {
+    auto parse(std::string_view input) -> Histogram {
+        auto histogram = Histogram{};
+        for (const auto line : core::strings::split_view(core::strings::strip(input), "\n")) {
+            histogram.emplace_back(core::numbers::parse_numbers<std::int64_t>(line));
+        }
+        return histogram;
+    }
 
-    const auto predictions_sum = sum_of_predictions(histogram);
-    std::cout << std::format("the sum of these extrapolated values is {}\n", predictions_sum);
+    auto part_one(const Histogram& histogram) -> std::int64_t {
+        return sum_of_predictions(histogram);
+    }
 
-    const auto backwards_predictions_sum = sum_of_backwards_predictions(histogram);
-    std::cout << std::format("the sum of these backwards predictions is {}\n", backwards_predictions_sum);
-    return 0;
-}
+    auto part_two(const Histogram& histogram) -> std::int64_t {
+        return sum_of_backwards_predictions(histogram);
+    }
+
+    auto solve(std::string_view input) -> core::Answers {
+        const auto histogram = parse(input);
+        return {std::format("{}", part_one(histogram)), std::format("{}", part_two(histogram))};
+    }
+
+    auto solve_stream(core::io::LineReader& input) -> core::Answers {
+        auto predictions           = std::int64_t{0};
+        auto backwards_predictions = std::int64_t{0};
+        // parsing the next sequences overlaps with extrapolating the current one
+        for (const auto& sequence : core::prefetch(load_sequences(input))) {
+            predictions += predict(sequence);
+            backwards_predictions += predict_backwards(sequence);
+        }
+        return {std::format("{}", predictions), std::format("{}", backwards_predictions)};
+    }
+
+    auto solve_cached(std::string_view input, const core::cache::Store& store) -> core::Answers {
+        const auto histogram = store.load_or_parse("day-9", CACHE_SCHEMA, input, parse, save, load);
+        return {std::format("{}", part_one(histogram)), std::format("{}", part_two(histogram))};
+    }
+}  // namespace day_9
@@ -0,0 +1,27 @@
+#ifndef MIRAGE_MAINTENANCE_HXX
+#define MIRAGE_MAINTENANCE_HXX
+
+#include <core/solution.hxx>
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+
+namespace core::cache {
+    class Store;
+}  // namespace core::cache
+
+
+namespace day_9 {
+    using Histogram = std::vector<std::vector<std::int64_t>>;
+
+    auto parse(std::string_view input) -> Histogram;
+    auto part_one(const Histogram& histogram) -> std::int64_t;
+    auto part_two(const Histogram& histogram) -> std::int64_t;
+    auto solve(std::string_view input) -> core::Answers;
+    auto solve_stream(core::io::LineReader& input) -> core::Answers;
+    auto solve_cached(std::string_view input, const core::cache::Store& store) -> core::Answers;
+}  // namespace day_9
+
+#endif  // MIRAGE_MAINTENANCE_HXX
@@ -0,0 +1,101 @@
+#include "generators.hxx"
+
+#include <core/numbers.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+
+namespace {
+    const auto DAYS = std::map<std::size_t, gen::Generator>{
+        {1, {gen::day_1, 1'000}},   {2, {gen::day_2, 100}},     {3, {gen::day_3, 140}},    {4, {gen::day_4, 200}},
+        {5, {gen::day_5, 32}},      {6, {gen::day_6, 4}},       {7, {gen::day_7, 1'000}},  {8, {gen::day_8, 700}},
+        {9, {gen::day_9, 200}},     {10, {gen::day_10, 140}},   {11, {gen::day_11, 140}},  {12, {gen::day_12, 1'000}},
+        {13, {gen::day_13, 100}},   {14, {gen::day_14, 100}},   {15, {gen::day_15, 4'000}}, {16, {gen::day_16, 110}},
+        {17, {gen::day_17, 141}},   {18, {gen::day_18, 600}},   {19, {gen::day_19, 575}},  {20, {gen::day_20, 56}},
+        {21, {gen::day_21, 131}},
+    };
+
+    struct Arguments {
+        std::size_t                day = 0;
+        std::optional<std::size_t> size;
+        std::uint64_t              seed = 2023;  // NOLINT: just a default seed
+        std::filesystem::path      output;
+    };
+
+    auto usage() -> std::string_view {
+        return "usage: aoc-gen --day N [--size N] [--seed N] [--output FILE]\n"
+               "  writes a random input for the day; the size is the number of records or the side of the grid\n";
+    }
+
+    auto parse_arguments(std::span<char*> arguments) -> Arguments {
+        auto result = Arguments{};
+
+        for (auto it = arguments.begin(); it != arguments.end(); ++it) {
+            const auto argument = std::string_view{*it};
+            const auto value    = [&]() -> std::string_view {
+                if (std::next(it) == arguments.end()) {
+                    throw std::invalid_argument(std::format("missing value for {}", argument));
+                }
+                return *++it;
+            };
+
+            if (argument == "--day") {
+                result.day = core::numbers::parse<std::size_t>(value());
+            } else if (argument == "--size") {
+                result.size = core::numbers::parse<std::size_t>(value());
+            } else if (argument == "--seed") {
+                result.seed = core::numbers::parse<std::uint64_t>(value());
+            } else if (argument == "--output") {
+                result.output = value();
+            } else {
+                throw std::invalid_argument(std::format("unknown argument {}", argument));
+            }
+        }
+
+        if (not DAYS.contains(result.day)) {
+            throw std::invalid_argument(std::format("there is no generator for day {}", result.day));
+        }
+        if (result.size == 0) {
+            throw std::invalid_argument("the size must be positive");
+        }
+
+        return result;
+    }
+}  // namespace
+
+
+auto main(int argc, char* argv[]) -> int {
+    try {
+        const auto arguments = parse_arguments({argv + 1, argv + argc});
+        const auto generator = DAYS.at(arguments.day);
+
+        auto random = gen::Random{arguments.seed};
+        if (arguments.output.empty()) {
+            std::ios::sync_with_stdio(false);
+            generator.generate(std::cout, arguments.size.value_or(generator.size), random);
+        } else {
+            auto stream = std::ofstream{arguments.output};
+            generator.generate(stream, arguments.size.value_or(generator.size), random);
+        }
+    } catch (const std::invalid_argument& ex) {
+        std::cerr << std::format("{}\n{}", ex.what(), usage());
+        return 2;
+    } catch (const std::exception& ex) {  // NOLINT: std::exception if fine here
+        std::cerr << std::format("Critical error: {}\n", ex.what());
+        return 1;
+    }
+
+    return 0;
+}
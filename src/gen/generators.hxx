@@ -0,0 +1,59 @@
+#ifndef GEN_GENERATORS_HXX
+#define GEN_GENERATORS_HXX
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ostream>
+#include <random>
+
+
+namespace gen {
+    using Random = std::mt19937_64;
+
+    // `size` is the scale knob of a day: the number of records or the side of a grid
+    using Generate = auto (*)(std::ostream& output, std::size_t size, Random& random) -> void;
+
+    struct Generator {
+        Generate    generate = nullptr;
+        std::size_t size     = 0;  // the scale of the published puzzle input
+    };
+
+    template<std::integral T>
+    auto uniform(Random& random, T low, T high) -> T {
+        return std::uniform_int_distribution<T>{low, high}(random);
+    }
+
+    inline auto chance(Random& random, double probability) -> bool {
+        return std::bernoulli_distribution{probability}(random);
+    }
+
+    template<std::random_access_iterator Iterator>
+    auto pick(Random& random, Iterator first, Iterator last) -> decltype(*first) {
+        return first[uniform<std::ptrdiff_t>(random, 0, std::distance(first, last) - 1)];
+    }
+
+    auto day_1(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_2(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_3(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_4(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_5(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_6(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_7(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_8(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_9(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_10(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_11(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_12(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_13(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_14(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_15(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_16(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_17(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_18(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_19(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_20(std::ostream& output, std::size_t size, Random& random) -> void;
+    auto day_21(std::ostream& output, std::size_t size, Random& random) -> void;
+}  // namespace gen
+
+#endif  // GEN_GENERATORS_HXX
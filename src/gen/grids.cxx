@@ -0,0 +1,335 @@
+#include "generators.hxx"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+namespace {
+    using gen::chance;
+    using gen::pick;
+    using gen::Random;
+    using gen::uniform;
+
+    using Rows = std::vector<std::string>;
+
+
+    auto make_rows(std::size_t side, char fill) -> Rows {
+        return Rows(side, std::string(side, fill));
+    }
+
+    auto write_rows(std::ostream& output, const Rows& rows) -> void {
+        for (const auto& row : rows) {
+            output << row << '\n';
+        }
+    }
+
+    auto scatter(Random& random, Rows& rows, std::string_view symbols, double density) -> void {
+        for (auto& row : rows) {
+            for (auto& cell : row) {
+                if (chance(random, density)) {
+                    cell = pick(random, symbols.begin(), symbols.end());
+                }
+            }
+        }
+    }
+
+    // A spanning tree of a `side` x `side` lattice, drawn with three cells between the nodes so that the ring
+    // of cells around it is a single loop of pipes.
+    auto make_spanning_tree(Random& random, std::size_t side) -> std::vector<std::vector<bool>> {
+        const auto nodes = std::max<std::size_t>(side / 4, 1);
+        const auto cells = 4 * nodes + 1;
+
+        auto tree    = std::vector<std::vector<bool>>(cells, std::vector<bool>(cells, false));
+        auto visited = std::vector<bool>(nodes * nodes, false);
+        auto stack   = std::vector<std::size_t>{0};
+
+        const auto draw = [&](std::size_t node) { tree[4 * (node / nodes) + 2][4 * (node % nodes) + 2] = true; };
+
+        visited[0] = true;
+        draw(0);
+        while (not stack.empty()) {
+            const auto node = stack.back();
+            const auto row  = node / nodes;
+            const auto col  = node % nodes;
+
+            auto next = std::vector<std::size_t>{};
+            if (row > 0 && not visited[node - nodes]) {
+                next.push_back(node - nodes);
+            }
+            if (row + 1 < nodes && not visited[node + nodes]) {
+                next.push_back(node + nodes);
+            }
+            if (col > 0 && not visited[node - 1]) {
+                next.push_back(node - 1);
+            }
+            if (col + 1 < nodes && not visited[node + 1]) {
+                next.push_back(node + 1);
+            }
+
+            if (next.empty()) {
+                stack.pop_back();
+                continue;
+            }
+
+            const auto chosen = pick(random, next.begin(), next.end());
+            const auto from   = std::pair{4 * row + 2, 4 * col + 2};
+            const auto to     = std::pair{4 * (chosen / nodes) + 2, 4 * (chosen % nodes) + 2};
+            for (auto r = std::min(from.first, to.first); r <= std::max(from.first, to.first); ++r) {
+                for (auto c = std::min(from.second, to.second); c <= std::max(from.second, to.second); ++c) {
+                    tree[r][c] = true;
+                }
+            }
+
+            visited[chosen] = true;
+            stack.push_back(chosen);
+        }
+
+        return tree;
+    }
+
+    auto mismatches(const Rows& rows, std::size_t split) -> std::size_t {
+        auto count = 0ul;
+        for (auto offset = 0ul; offset < split && split + offset < rows.size(); ++offset) {
+            const auto& up   = rows[split - offset - 1];
+            const auto& down = rows[split + offset];
+            for (auto col = 0ul; col != up.size(); ++col) {
+                count += (up[col] != down[col]) ? 1 : 0;
+            }
+        }
+        return count;
+    }
+
+    auto transpose(const Rows& rows) -> Rows {
+        auto result = Rows(rows.front().size(), std::string(rows.size(), '.'));
+        for (auto row = 0ul; row != rows.size(); ++row) {
+            for (auto col = 0ul; col != rows[row].size(); ++col) {
+                result[col][row] = rows[row][col];
+            }
+        }
+        return result;
+    }
+
+    auto reflect(Rows& rows, std::size_t split) -> void {
+        for (auto offset = 0ul; offset < split && split + offset < rows.size(); ++offset) {
+            rows[split + offset] = rows[split - offset - 1];
+        }
+    }
+
+    // One mirror line without smudges and exactly one other line with a single smudge; rejected when the random
+    // fill accidentally produces more candidates.
+    auto make_note(Random& random) -> Rows {
+        while (true) {
+            const auto height = uniform<std::size_t>(random, 5, 17);
+            const auto width  = uniform<std::size_t>(random, 5, 17);
+
+            auto note = Rows(height, std::string(width, '.'));
+            scatter(random, note, "#", 0.5);
+
+            // the clean line goes across the rows and the smudged one across the columns, in random orientation
+            const auto clean   = uniform<std::size_t>(random, 1, height - 1);
+            const auto smudged = uniform<std::size_t>(random, 1, width - 1);
+            reflect(note, clean);
+            note = transpose(note);
+            reflect(note, smudged);
+            note = transpose(note);
+
+            // the smudge goes to a row the clean reflection does not cover, but inside the smudged one
+            const auto covered = std::min(clean, height - clean);
+            if (2 * covered == height) {
+                continue;
+            }
+
+            const auto span = std::min(smudged, width - smudged);
+            const auto row  = (clean < height - clean) ? uniform(random, 2 * clean, height - 1)
+                                                       : uniform(random, 0ul, height - 2 * covered - 1);
+            auto& cell = note[row][uniform(random, smudged - span, smudged + span - 1)];
+            cell       = (cell == '#') ? '.' : '#';
+
+            if (chance(random, 0.5)) {
+                note = transpose(note);
+            }
+
+            auto perfect  = 0ul;
+            auto smudges  = 0ul;
+            const auto by = [&](const Rows& grid) {
+                for (auto split = 1ul; split != grid.size(); ++split) {
+                    const auto count = mismatches(grid, split);
+                    perfect += count == 0 ? 1 : 0;
+                    smudges += count == 1 ? 1 : 0;
+                }
+            };
+            by(note);
+            by(transpose(note));
+
+            if (perfect == 1 && smudges == 1) {
+                return note;
+            }
+        }
+    }
+}  // namespace
+
+
+namespace gen {
+    auto day_3(std::ostream& output, std::size_t size, Random& random) -> void {
+        constexpr auto SYMBOLS = std::string_view{"***#+$/=%@&-"};
+
+        auto schema = make_rows(size, '.');
+        for (auto& row : schema) {
+            for (auto col = 0ul; col < size; ++col) {
+                if (chance(random, 0.04)) {
+                    row[col] = pick(random, SYMBOLS.begin(), SYMBOLS.end());
+                } else if (chance(random, 0.12)) {
+                    const auto digits = std::min(uniform<std::size_t>(random, 1, 3), size - col);
+                    for (auto end = col + digits; col != end; ++col) {
+                        row[col] = static_cast<char>('0' + uniform(random, 0, 9));
+                    }
+                }
+            }
+        }
+        write_rows(output, schema);
+    }
+
+    auto day_10(std::ostream& output, std::size_t size, Random& random) -> void {
+        constexpr auto JUNK = std::string_view{"|-LJ7F..."};
+
+        const auto tree = make_spanning_tree(random, size);
+        const auto side = tree.size();
+        const auto inside = [&](std::ptrdiff_t row, std::ptrdiff_t col) {
+            return row >= 0 && col >= 0 && std::cmp_less(row, side) && std::cmp_less(col, side);
+        };
+        const auto at = [&](std::ptrdiff_t row, std::ptrdiff_t col) { return inside(row, col) && tree[row][col]; };
+
+        // the loop is the ring of cells touching the tree, the tree itself ends up enclosed
+        const auto is_loop = [&](std::ptrdiff_t row, std::ptrdiff_t col) {
+            if (not inside(row, col) || at(row, col)) {
+                return false;
+            }
+            for (auto dr = -1; dr <= 1; ++dr) {
+                for (auto dc = -1; dc <= 1; ++dc) {
+                    if (at(row + dr, col + dc)) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        };
+
+        auto maze = make_rows(side, '.');
+        scatter(random, maze, JUNK, 1.0);
+
+        auto loop = std::vector<std::pair<std::size_t, std::size_t>>{};
+        for (auto row = 0l; std::cmp_less(row, side); ++row) {
+            for (auto col = 0l; std::cmp_less(col, side); ++col) {
+                if (not is_loop(row, col)) {
+                    continue;
+                }
+
+                const auto north = is_loop(row - 1, col);
+                const auto south = is_loop(row + 1, col);
+                const auto west  = is_loop(row, col - 1);
+                const auto east  = is_loop(row, col + 1);
+                if (north + south + west + east != 2) {
+                    throw std::logic_error("the pipe loop is not simple");
+                }
+
+                auto& tile = maze[row][col];
+                if (north && south) {
+                    tile = '|';
+                } else if (west && east) {
+                    tile = '-';
+                } else if (north) {
+                    tile = east ? 'L' : 'J';
+                } else {
+                    tile = east ? 'F' : '7';
+                }
+                loop.emplace_back(row, col);
+            }
+        }
+
+        // only the two loop neighbours may connect to the start
+        const auto [row, col] = pick(random, loop.begin(), loop.end());
+        for (const auto& [dr, dc] : std::array<std::pair<int, int>, 4>{{{-1, 0}, {1, 0}, {0, -1}, {0, 1}}}) {
+            const auto r = static_cast<std::ptrdiff_t>(row) + dr;
+            const auto c = static_cast<std::ptrdiff_t>(col) + dc;
+            if (inside(r, c) && not is_loop(r, c)) {
+                maze[r][c] = '.';
+            }
+        }
+        maze[row][col] = 'S';
+
+        write_rows(output, maze);
+    }
+
+    auto day_11(std::ostream& output, std::size_t size, Random& random) -> void {
+        auto image = make_rows(size, '.');
+        scatter(random, image, "#", 0.02);
+
+        for (auto index = 0ul; index != size; ++index) {
+            if (chance(random, 0.05)) {
+                std::ranges::fill(image[index], '.');
+            }
+            if (chance(random, 0.05)) {
+                std::ranges::for_each(image, [index](std::string& row) { row[index] = '.'; });
+            }
+        }
+        write_rows(output, image);
+    }
+
+    auto day_13(std::ostream& output, std::size_t size, Random& random) -> void {
+        for (auto index = 0ul; index != size; ++index) {
+            if (index != 0) {
+                output << '\n';
+            }
+            write_rows(output, make_note(random));
+        }
+    }
+
+    auto day_14(std::ostream& output, std::size_t size, Random& random) -> void {
+        auto platform = make_rows(size, '.');
+        scatter(random, platform, "OOOOO####", 0.35);
+        write_rows(output, platform);
+    }
+
+    auto day_16(std::ostream& output, std::size_t size, Random& random) -> void {
+        auto contraption = make_rows(size, '.');
+        scatter(random, contraption, "/\\|-", 0.1);
+        write_rows(output, contraption);
+    }
+
+    auto day_17(std::ostream& output, std::size_t size, Random& random) -> void {
+        auto map = make_rows(size, '.');
+        scatter(random, map, "123456789", 1.0);
+        write_rows(output, map);
+    }
+
+    // The infinite garden only works out for odd sides with the start in the centre and clear middle lines,
+    // border and diamond, which is also how the published inputs look.
+    auto day_21(std::ostream& output, std::size_t size, Random& random) -> void {
+        const auto side   = size | 1;
+        const auto middle = side / 2;
+
+        auto garden = make_rows(side, '.');
+        for (auto row = 1ul; row + 1 < side; ++row) {
+            for (auto col = 1ul; col + 1 < side; ++col) {
+                const auto distance = std::abs(static_cast<std::ptrdiff_t>(row) - static_cast<std::ptrdiff_t>(middle))
+                                    + std::abs(static_cast<std::ptrdiff_t>(col) - static_cast<std::ptrdiff_t>(middle));
+                const auto diamond = std::cmp_equal(distance, middle) || std::cmp_equal(distance, middle + 1);
+                if (row != middle && col != middle && not diamond && chance(random, 0.12)) {
+                    garden[row][col] = '#';
+                }
+            }
+        }
+        garden[middle][middle] = 'S';
+
+        write_rows(output, garden);
+    }
+}  // namespace gen
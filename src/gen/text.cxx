@@ -0,0 +1,528 @@
+#include "generators.hxx"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <iterator>
+#include <numeric>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+
+namespace {
+    using gen::chance;
+    using gen::pick;
+    using gen::Random;
+    using gen::uniform;
+
+    constexpr auto LETTERS = std::string_view{"abcdefghijklmnopqrstuvwxyz"};
+
+    auto make_label(Random& random, std::size_t length, std::string_view letters = LETTERS) -> std::string {
+        auto label = std::string(length, ' ');
+        std::ranges::generate(label, [&] { return pick(random, letters.begin(), letters.end()); });
+        return label;
+    }
+
+    // unique lowercase labels, as short as possible while random picks still rarely collide
+    auto make_labels(Random& random, std::size_t count, const std::unordered_set<std::string>& reserved)
+        -> std::vector<std::string> {
+        auto length = 2ul;
+        for (auto capacity = LETTERS.size() * LETTERS.size(); capacity < 4 * count; capacity *= LETTERS.size()) {
+            length++;
+        }
+
+        auto labels = std::vector<std::string>{};
+        auto seen   = reserved;
+        while (labels.size() != count) {
+            if (auto label = make_label(random, length); seen.insert(label).second) {
+                labels.push_back(std::move(label));
+            }
+        }
+        return labels;
+    }
+
+    template<typename Range>
+    auto join(const Range& items, std::string_view separator) -> std::string {
+        auto result = std::string{};
+        for (const auto& item : items) {
+            if (not result.empty()) {
+                result += separator;
+            }
+            result += item;
+        }
+        return result;
+    }
+
+    auto primes(std::uint64_t low, std::uint64_t high) -> std::vector<std::uint64_t> {
+        auto result = std::vector<std::uint64_t>{};
+        for (auto candidate = std::max(low, 2ul); candidate <= high; ++candidate) {
+            auto prime = true;
+            for (auto divisor = 2ul; prime && divisor * divisor <= candidate; ++divisor) {
+                prime = (candidate % divisor) != 0;
+            }
+            if (prime) {
+                result.push_back(candidate);
+            }
+        }
+        return result;
+    }
+
+    // A simple rectilinear polygon: a strip of columns with a random skyline above and below the axis.
+    auto make_outline(Random& random, std::size_t columns, std::int64_t width, std::int64_t height)
+        -> std::vector<std::pair<char, std::int64_t>> {
+        const auto next_level = [&](std::int64_t previous) {
+            auto level = previous;
+            while (level == previous) {
+                level = uniform<std::int64_t>(random, 1, height);
+            }
+            return level;
+        };
+
+        auto widths = std::vector<std::int64_t>(columns);
+        auto tops   = std::vector<std::int64_t>(columns);
+        auto bottom = std::vector<std::int64_t>(columns);
+        for (auto column = 0ul; column != columns; ++column) {
+            widths[column] = uniform<std::int64_t>(random, 1, width);
+            tops[column]   = next_level(column == 0 ? 0 : tops[column - 1]);
+            bottom[column] = next_level(column == 0 ? 0 : bottom[column - 1]);
+        }
+
+        const auto vertical = [](std::int64_t from, std::int64_t to) {
+            return std::pair{to > from ? 'U' : 'D', std::abs(to - from)};
+        };
+
+        auto outline = std::vector<std::pair<char, std::int64_t>>{{'U', bottom.front() + tops.front()}};
+        for (auto column = 0ul; column != columns; ++column) {
+            if (column != 0) {
+                outline.push_back(vertical(tops[column - 1], tops[column]));
+            }
+            outline.emplace_back('R', widths[column]);
+        }
+        outline.emplace_back('D', tops.back() + bottom.back());
+        for (auto column = columns; column-- > 0;) {
+            if (column + 1 != columns) {
+                outline.push_back(vertical(-bottom[column + 1], -bottom[column]));
+            }
+            outline.emplace_back('L', widths[column]);
+        }
+        return outline;
+    }
+
+    // Flip-flops of the bits set in `period` report to the conjunction, which resets the counter at `period`.
+    auto write_counter(std::ostream& output, const std::vector<std::string>& bits, const std::string& conjunction,
+                       std::uint64_t period, const std::string& report) -> void {
+        auto resets = std::vector<std::string>{bits.front()};
+        for (auto bit = 0ul; bit != bits.size(); ++bit) {
+            auto targets = std::vector<std::string>{};
+            if (bit + 1 != bits.size()) {
+                targets.push_back(bits[bit + 1]);
+            }
+            if ((period >> bit) & 1) {
+                targets.push_back(conjunction);
+            } else {
+                resets.push_back(bits[bit]);
+            }
+            output << std::format("%{} -> {}\n", bits[bit], join(targets, ", "));
+        }
+
+        if (not report.empty()) {
+            resets.push_back(report);
+        }
+        output << std::format("&{} -> {}\n", conjunction, join(resets, ", "));
+    }
+}  // namespace
+
+
+namespace gen {
+    auto day_1(std::ostream& output, std::size_t size, Random& random) -> void {
+        constexpr auto DIGITS = std::string_view{"123456789"};
+        constexpr auto WORDS  = std::array<std::string_view, 9>{
+            "one", "two", "three", "four", "five", "six", "seven", "eight", "nine",
+        };
+
+        for (auto line = 0ul; line != size; ++line) {
+            auto text = make_label(random, uniform(random, 1ul, 12ul));
+            for (auto pieces = uniform(random, 1, 4); pieces-- > 0;) {
+                const auto at = uniform(random, 0ul, text.size());
+                if (chance(random, 0.6)) {
+                    text.insert(at, 1, pick(random, DIGITS.begin(), DIGITS.end()));
+                } else {
+                    text.insert(at, pick(random, WORDS.begin(), WORDS.end()));
+                }
+            }
+
+            // every line carries at least one real digit
+            if (std::ranges::none_of(text, [](char symbol) { return symbol >= '0' && symbol <= '9'; })) {
+                text.insert(uniform(random, 0ul, text.size()), 1, pick(random, DIGITS.begin(), DIGITS.end()));
+            }
+            output << text << '\n';
+        }
+    }
+
+    auto day_2(std::ostream& output, std::size_t size, Random& random) -> void {
+        auto colors = std::array<std::string_view, 3>{"red", "green", "blue"};
+
+        for (auto game = 1ul; game <= size; ++game) {
+            auto sets = std::vector<std::string>{};
+            for (auto count = uniform(random, 1, 6); count-- > 0;) {
+                std::ranges::shuffle(colors, random);
+
+                auto cubes = std::vector<std::string>{};
+                for (auto color = 0, shown = uniform(random, 1, 3); color != shown; ++color) {
+                    cubes.push_back(std::format("{} {}", uniform(random, 1, 20), colors[color]));
+                }
+                sets.push_back(join(cubes, ", "));
+            }
+            output << std::format("Game {}: {}\n", game, join(sets, "; "));
+        }
+    }
+
+    // Most cards win nothing: with less than one match per card on average the number of copies stays bounded.
+    auto day_4(std::ostream& output, std::size_t size, Random& random) -> void {
+        constexpr auto WINNING = 10ul;
+        constexpr auto NUMBERS = 25ul;
+
+        auto pool = std::vector<int>(99);
+        std::iota(pool.begin(), pool.end(), 1);
+
+        for (auto card = 1ul; card <= size; ++card) {
+            std::ranges::shuffle(pool, random);
+
+            const auto matches = chance(random, 0.75) ? 0ul : std::min(uniform(random, 1ul, 4ul), size - card);
+            auto       winning = std::vector<int>(pool.begin(), pool.begin() + WINNING);
+            auto       numbers = std::vector<int>(pool.begin(), pool.begin() + static_cast<std::ptrdiff_t>(matches));
+            numbers.insert(numbers.end(), pool.begin() + WINNING, pool.begin() + WINNING + NUMBERS - matches);
+            std::ranges::shuffle(numbers, random);
+
+            output << std::format("Card {:>3}:", card);
+            std::ranges::for_each(winning, [&](int number) { output << std::format(" {:>2}", number); });
+            output << " |";
+            std::ranges::for_each(numbers, [&](int number) { output << std::format(" {:>2}", number); });
+            output << '\n';
+        }
+    }
+
+    // Every map cuts the 32-bit space into `size` ranges and lays them out again in random order; a few ranges
+    // are left out and map onto themselves.
+    auto day_5(std::ostream& output, std::size_t size, Random& random) -> void {
+        constexpr auto SPACE  = std::uint64_t{1} << 32;
+        constexpr auto SPREAD = std::uint64_t{1} << 28;
+        constexpr auto MAPS   = std::array<std::string_view, 7>{
+            "seed-to-soil",
+            "soil-to-fertilizer",
+            "fertilizer-to-water",
+            "water-to-light",
+            "light-to-temperature",
+            "temperature-to-humidity",
+            "humidity-to-location",
+        };
+
+        auto seeds = std::vector<std::string>{};
+        for (auto pair = 0ul; pair != std::max(size / 3, 1ul); ++pair) {
+            seeds.push_back(std::format("{} {}", uniform(random, 0ul, SPACE - SPREAD), uniform(random, 1ul, SPREAD)));
+        }
+        output << std::format("seeds: {}\n", join(seeds, " "));
+
+        for (const auto name : MAPS) {
+            auto cuts = std::vector<std::uint64_t>{0, SPACE};
+            while (cuts.size() < size + 1) {
+                cuts.push_back(uniform(random, 1ul, SPACE - 1));
+            }
+            std::ranges::sort(cuts);
+            cuts.erase(std::ranges::unique(cuts).begin(), cuts.end());
+
+            auto order = std::vector<std::size_t>(cuts.size() - 1);
+            std::iota(order.begin(), order.end(), 0);
+            std::ranges::shuffle(order, random);
+
+            output << std::format("\n{} map:\n", name);
+            for (auto destination = std::uint64_t{0}; const auto range : order) {
+                const auto length = cuts[range + 1] - cuts[range];
+                if (not chance(random, 0.1)) {
+                    output << std::format("{} {} {}\n", destination, cuts[range], length);
+                }
+                destination += length;
+            }
+        }
+    }
+
+    // The races are concatenated for the second part, so there are never more of them than fit in 64 bits.
+    auto day_6(std::ostream& output, std::size_t size, Random& random) -> void {
+        auto times   = std::vector<std::string>{};
+        auto records = std::vector<std::string>{};
+        for (auto race = 0ul; race != std::clamp(size, 1ul, 4ul); ++race) {
+            const auto time = uniform(random, 10ul, 99ul);
+            const auto best = (time / 2) * (time - time / 2);
+            times.push_back(std::to_string(time));
+            records.push_back(std::to_string(uniform(random, best / 2, best - 1)));
+        }
+        output << std::format("Time:      {}\nDistance:  {}\n", join(times, "  "), join(records, "  "));
+    }
+
+    auto day_7(std::ostream& output, std::size_t size, Random& random) -> void {
+        constexpr auto CARDS = std::string_view{"AKQJT98765432"};
+
+        auto hands = std::unordered_set<std::string>{};
+        while (hands.size() != std::min(size, 371'293ul)) {  // 13 ^ 5 different hands
+            if (auto hand = make_label(random, 5, CARDS); hands.insert(hand).second) {
+                output << std::format("{} {}\n", hand, uniform(random, 1, 1000));
+            }
+        }
+    }
+
+    // Every ghost walks a ring of node pairs, whichever way the instructions point, and meets its end after
+    // `prime * instructions` steps; this is the shape the part two shortcut relies on. Node names have three
+    // letters, which caps the map at about sixteen thousand nodes.
+    auto day_8(std::ostream& output, std::size_t size, Random& random) -> void {
+        constexpr auto UPPER = std::string_view{"ABCDEFGHIJKLMNOPQRSTUVWXYZ"};
+        constexpr auto INNER = std::string_view{"BCDEFGHIJKLMNOPQRSTUVWXY"};
+
+        auto periods = std::vector<std::uint64_t>{};
+        std::ranges::sample(primes(11, 79), std::back_inserter(periods), uniform(random, 2, 6), random);
+        std::ranges::shuffle(periods, random);
+
+        const auto total  = std::reduce(periods.begin(), periods.end());
+        const auto length = std::max(std::min(size, 16'000ul) / (2 * total), 1ul);
+
+        auto       used = std::unordered_set<std::string>{"AAA", "ZZZ"};
+        const auto name = [&](char last) {
+            while (true) {
+                auto label = make_label(random, 2, UPPER);
+                label += last == ' ' ? pick(random, INNER.begin(), INNER.end()) : last;
+                if (used.insert(label).second) {
+                    return label;
+                }
+            }
+        };
+
+        auto nodes = std::vector<std::string>{};
+        for (auto ghost = 0ul; ghost != periods.size(); ++ghost) {
+            const auto steps = periods[ghost] * length;
+            const auto start = ghost == 0 ? std::string{"AAA"} : name('A');
+            const auto end   = ghost == 0 ? std::string{"ZZZ"} : name('Z');
+
+            auto ring = std::vector<std::pair<std::string, std::string>>{};
+            for (auto layer = 1ul; layer != steps; ++layer) {
+                ring.emplace_back(name(' '), name(' '));
+            }
+            ring.emplace_back(end, end);
+
+            nodes.push_back(std::format("{} = ({}, {})", start, ring.front().first, ring.front().second));
+            nodes.push_back(std::format("{} = ({}, {})", end, ring.front().first, ring.front().second));
+            for (auto layer = 0ul; layer + 1 != ring.size(); ++layer) {
+                const auto& [left, right] = ring[layer + 1];
+                nodes.push_back(std::format("{} = ({}, {})", ring[layer].first, left, right));
+                nodes.push_back(std::format("{} = ({}, {})", ring[layer].second, left, right));
+            }
+        }
+        std::ranges::shuffle(nodes, random);
+
+        output << make_label(random, length, "LR") << "\n\n";
+        std::ranges::for_each(nodes, [&](const std::string& node) { output << node << '\n'; });
+    }
+
+    // Sequences are polynomials written through their leading differences, so the extrapolation is exact.
+    auto day_9(std::ostream& output, std::size_t size, Random& random) -> void {
+        constexpr auto VALUES = 21l;
+
+        for (auto line = 0ul; line != size; ++line) {
+            auto differences = std::vector<std::int64_t>(uniform(random, 2, 12));
+            std::ranges::generate(differences, [&] { return uniform<std::int64_t>(random, -9, 9); });
+
+            auto values = std::vector<std::string>{};
+            for (auto x = 0l; x != VALUES; ++x) {
+                auto value    = std::int64_t{0};
+                auto binomial = std::int64_t{1};
+                for (auto k = 0l; std::cmp_less(k, differences.size()) && k <= x; ++k) {
+                    value    += differences[k] * binomial;
+                    binomial  = binomial * (x - k) / (k + 1);
+                }
+                values.push_back(std::to_string(value));
+            }
+            output << join(values, " ") << '\n';
+        }
+    }
+
+    // Records start from a real arrangement of the groups, so every line has at least one solution.
+    auto day_12(std::ostream& output, std::size_t size, Random& random) -> void {
+        constexpr auto LENGTH = 20ul;
+
+        for (auto line = 0ul; line != size; ++line) {
+            auto groups = std::vector<std::size_t>{};
+            auto used   = 0ul;
+            for (auto count = uniform(random, 1, 6); count-- > 0;) {
+                const auto group = uniform(random, 1ul, 5ul);
+                if (used + group + (groups.empty() ? 0 : 1) > LENGTH) {
+                    break;
+                }
+                used += group + (groups.empty() ? 0 : 1);
+                groups.push_back(group);
+            }
+
+            auto gaps = std::vector<std::size_t>(groups.size() + 1, 0);
+            std::fill(gaps.begin() + 1, gaps.end() - 1, 1);
+            for (auto extra = uniform(random, 0ul, LENGTH - used); extra-- > 0;) {
+                gaps[uniform(random, 0ul, gaps.size() - 1)]++;
+            }
+
+            auto springs = std::string(gaps.front(), '.');
+            for (auto group = 0ul; group != groups.size(); ++group) {
+                springs += std::string(groups[group], '#') + std::string(gaps[group + 1], '.');
+            }
+            std::ranges::replace_if(springs, [&](char) { return chance(random, 0.45); }, '?');
+
+            auto sizes = std::vector<std::string>{};
+            std::ranges::transform(groups, std::back_inserter(sizes), [](auto group) { return std::to_string(group); });
+            output << std::format("{} {}\n", springs, join(sizes, ","));
+        }
+    }
+
+    auto day_15(std::ostream& output, std::size_t size, Random& random) -> void {
+        auto labels = std::vector<std::string>{};
+        for (auto count = std::max(size / 8, 1ul); count-- > 0;) {
+            labels.push_back(make_label(random, uniform(random, 2ul, 6ul)));
+        }
+
+        auto steps = std::vector<std::string>{};
+        for (auto step = 0ul; step != size; ++step) {
+            const auto& label = pick(random, labels.begin(), labels.end());
+            steps.push_back(chance(random, 0.3) ? label + '-' : std::format("{}={}", label, uniform(random, 1, 9)));
+        }
+        output << join(steps, ",") << '\n';
+    }
+
+    // Both readings of the plan describe the same number of trenches: small ones for the first part and the
+    // hexadecimal ones, limited to five digits, for the second.
+    auto day_18(std::ostream& output, std::size_t size, Random& random) -> void {
+        constexpr auto DIRECTIONS = std::string_view{"RDLU"};
+
+        const auto columns = std::max(size / 4, 1ul);
+        const auto bugged  = make_outline(random, columns, 6, 8);
+        const auto fixed   = make_outline(random, columns, 0xFFFFF, 0x7FFFF);
+
+        for (auto index = 0ul; index != bugged.size(); ++index) {
+            const auto [direction, distance] = bugged[index];
+            const auto [code, length]        = fixed[index];
+            output << std::format("{} {} (#{:05x}{})\n", direction, distance, length, DIRECTIONS.find(code));
+        }
+    }
+
+    // Workflows form a tree rooted at `in`, so every part ends up accepted or rejected. Each workflow knows the
+    // ratings that can reach it and only splits them into two non-empty halves.
+    auto day_19(std::ostream& output, std::size_t size, Random& random) -> void {
+        constexpr auto CATEGORIES = std::string_view{"xmas"};
+        constexpr auto RATINGS    = std::pair{1, 4'000};
+
+        using Ratings = std::array<std::pair<int, int>, 4>;
+
+        const auto names = make_labels(random, size - 1, {"in"});
+
+        auto workflows = std::vector<std::string>{};
+        auto pending   = std::vector<std::pair<std::string, Ratings>>{{"in", {RATINGS, RATINGS, RATINGS, RATINGS}}};
+        auto created   = 1ul;
+        for (auto index = 0ul; index != pending.size(); ++index) {
+            auto ratings = pending[index].second;
+            auto rules   = std::vector<std::string>{};
+
+            const auto slots    = uniform(random, 2ul, 4ul);
+            auto       children = 0ul;
+            for (auto slot = 0ul; slot != slots; ++slot) {
+                auto splittable = std::vector<std::size_t>{};
+                for (auto category = 0ul; category != ratings.size(); ++category) {
+                    if (ratings[category].first < ratings[category].second) {
+                        splittable.push_back(category);
+                    }
+                }
+
+                const auto last      = slot + 1 == slots || splittable.empty();
+                auto       condition = std::string{};
+                auto       matched   = ratings;
+                if (not last) {
+                    const auto category = pick(random, splittable.begin(), splittable.end());
+                    auto& [low, high]   = ratings[category];
+                    if (chance(random, 0.5)) {
+                        const auto threshold     = uniform(random, low + 1, high);
+                        matched[category].second = threshold - 1;
+                        low                      = threshold;
+                        condition                = std::format("{}<{}:", CATEGORIES[category], threshold);
+                    } else {
+                        const auto threshold    = uniform(random, low, high - 1);
+                        matched[category].first = threshold + 1;
+                        high                    = threshold;
+                        condition               = std::format("{}>{}:", CATEGORIES[category], threshold);
+                    }
+                }
+
+                // keep growing until every workflow is placed, even when the random choices would end the tree
+                const auto starving = index + 1 == pending.size() && last && children == 0;
+                auto       target   = std::string{chance(random, 0.5) ? "A" : "R"};
+                if (created < size && (starving || chance(random, 0.6))) {
+                    target = names[created++ - 1];
+                    pending.emplace_back(target, matched);
+                    children++;
+                }
+
+                rules.push_back(condition + target);
+                if (last) {
+                    break;
+                }
+            }
+            workflows.push_back(std::format("{}{{{}}}", pending[index].first, join(rules, ",")));
+        }
+        std::ranges::shuffle(workflows, random);
+
+        std::ranges::for_each(workflows, [&](const std::string& workflow) { output << workflow << '\n'; });
+        output << '\n';
+        for (auto part = std::max(size / 3, 1ul); part-- > 0;) {
+            const auto rating = [&] { return uniform(random, RATINGS.first, RATINGS.second); };
+            output << std::format("{{x={},m={},a={},s={}}}\n", rating(), rating(), rating(), rating());
+        }
+    }
+
+    // Twelve-bit counters built from flip-flops, as in the puzzle. Four of them report to `rx` with prime periods,
+    // so the answer is their product; the rest only add traffic.
+    auto day_20(std::ostream& output, std::size_t size, Random& random) -> void {
+        constexpr auto BITS     = 12ul;
+        constexpr auto REPORTED = 4ul;
+        constexpr auto MODULES  = BITS + 1;
+
+        const auto counters = std::max(size / MODULES, REPORTED);
+        const auto labels   = make_labels(random, counters * MODULES + REPORTED + 1, {"rx", "broadcaster"});
+        const auto label    = [&labels](std::size_t counter, std::size_t module) -> const std::string& {
+            return labels[counter * MODULES + module];
+        };
+        const auto& collector = labels.back();
+
+        auto periods = std::vector<std::uint64_t>{};
+        std::ranges::sample(primes(3'700, 4'095), std::back_inserter(periods), REPORTED, random);
+
+        auto starts = std::vector<std::string>{};
+        for (auto counter = 0ul; counter != counters; ++counter) {
+            starts.push_back(label(counter, 0));
+        }
+        output << std::format("broadcaster -> {}\n", join(starts, ", "));
+
+        for (auto counter = 0ul; counter != counters; ++counter) {
+            const auto reported = counter < REPORTED;
+            const auto period   = reported ? periods[counter] : (uniform(random, 1ul << (BITS - 1), (1ul << BITS) - 1) | 1);
+            const auto inverter = reported ? labels[counters * MODULES + counter] : std::string{};
+
+            auto bits = std::vector<std::string>{};
+            for (auto bit = 0ul; bit != BITS; ++bit) {
+                bits.push_back(label(counter, bit));
+            }
+            write_counter(output, bits, label(counter, BITS), period, inverter);
+            if (reported) {
+                output << std::format("&{} -> {}\n", inverter, collector);
+            }
+        }
+        output << std::format("&{} -> rx\n", collector);
+    }
+}  // namespace gen
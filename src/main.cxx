@@ -1,7 +1,346 @@
+#include "solvers/solvers.hxx"
+
+#include <unistd.h>
+
+#include <core/arena.hxx>
+#include <core/cache.hxx>
+#include <core/io.hxx>
+#include <core/loader.hxx>
+#include <core/numbers.hxx>
+#include <core/profile.hxx>
+#include <core/strings.hxx>
+#include <core/thread-pool.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace {
+    struct Arguments {
+        std::vector<std::size_t> days;
+        std::filesystem::path    input;
+        std::filesystem::path    inputs = ".";
+        std::filesystem::path    batch;
+        std::size_t              threads    = 0;
+        std::size_t              read_ahead = 0;
+        std::filesystem::path    trace;
+        std::filesystem::path    cache;
+    };
+
+    using BatchSolver = std::function<core::Answers(std::string_view)>;
+
+    struct BatchResult {
+        core::Answers              answers;
+        std::optional<std::string> error;  // set for a failed input, whatever its message
+    };
+
+    // an exception without a message still has to read as a failure
+    auto describe(const std::exception& ex) -> std::string {
+        const auto message = std::string_view{ex.what()};
+        return message.empty() ? "unknown error" : std::string{message};
+    }
+
+    auto usage() -> std::string_view {
+        return "usage: aoc-2023 [--day N[,N...]] [--input FILE|- | --inputs DIR]\n"
+               "       aoc-2023 --day N --batch DIR|MANIFEST [--threads N] [--read-ahead N]\n"
+               "       any of the above [--cache DIR] [--trace FILE] (AOC_PROFILE builds only)\n"
+               "  solves the selected days (all by default) on FILE or on DIR/day-N/input.data\n"
+               "  --input - streams stdin through one of the line oriented days (1, 2, 4, 6, 7, 9, 12, 15)\n"
+               "  --batch solves one day on every file of DIR or on every path listed in MANIFEST (one per line)\n"
+               "  --read-ahead keeps N batch inputs in flight on an io_uring (plain reads where unavailable)\n"
+               "  --cache keeps the parsed inputs of days 1, 2, 4, 7, 9 and 19 in DIR and reuses them on the same input\n"
+               "  --trace writes the recorded profile as Chrome trace-event JSON, the summary goes to stderr\n";
+    }
+
+    auto parse_arguments(std::span<char*> arguments) -> Arguments {
+        auto result = Arguments{};
+
+        for (auto it = arguments.begin(); it != arguments.end(); ++it) {
+            const auto argument = std::string_view{*it};
+            const auto value    = [&]() -> std::string_view {
+                if (std::next(it) == arguments.end()) {
+                    throw std::invalid_argument(std::format("missing value for {}", argument));
+                }
+                return *++it;
+            };
+
+            if (argument == "--day") {
+                std::ranges::copy(core::numbers::parse_numbers<std::size_t>(value()), std::back_inserter(result.days));
+            } else if (argument == "--input") {
+                result.input = value();
+            } else if (argument == "--inputs") {
+                result.inputs = value();
+            } else if (argument == "--batch") {
+                result.batch = value();
+            } else if (argument == "--threads") {
+                result.threads = core::numbers::parse<std::size_t>(value());
+            } else if (argument == "--read-ahead") {
+                result.read_ahead = core::numbers::parse<std::size_t>(value());
+            } else if (argument == "--trace") {
+                result.trace = value();
+            } else if (argument == "--cache") {
+                result.cache = value();
+            } else {
+                throw std::invalid_argument(std::format("unknown argument {}", argument));
+            }
+        }
+
+        if (result.days.empty()) {
+            std::ranges::copy(solvers::registry() | std::views::keys, std::back_inserter(result.days));
+        }
+        if (not result.input.empty() && result.days.size() != 1) {
+            throw std::invalid_argument("--input requires exactly one --day");
+        }
+        if (result.input == "-" && not result.batch.empty()) {
+            throw std::invalid_argument("--input - can't be combined with --batch");
+        }
+        if (result.input == "-" && not result.cache.empty()) {
+            throw std::invalid_argument("--input - can't be combined with --cache");
+        }
+        if (not result.batch.empty() && result.days.size() != 1) {
+            throw std::invalid_argument("--batch requires exactly one --day");
+        }
+        if (result.read_ahead != 0 && result.batch.empty()) {
+            throw std::invalid_argument("--read-ahead requires --batch");
+        }
+        if (not result.trace.empty() && not core::profile::enabled()) {
+            throw std::invalid_argument("--trace requires a build with AOC_PROFILE=ON");
+        }
+
+        return result;
+    }
+
+    auto input_path(const Arguments& arguments, std::size_t day) -> std::filesystem::path {
+        if (not arguments.input.empty()) {
+            return arguments.input;
+        }
+        return arguments.inputs / std::format("day-{}", day) / "input.data";
+    }
+
+    auto open_cache(const Arguments& arguments) -> std::optional<core::cache::Store> {
+        if (arguments.cache.empty()) {
+            return std::nullopt;
+        }
+        return core::cache::Store{arguments.cache};
+    }
+
+    // the cached variant of the day when there is a cache and the day has one
+    auto make_solver(std::size_t day, const std::optional<core::cache::Store>& store) -> BatchSolver {
+        if (const auto& cached = solvers::cached_registry(); store && cached.contains(day)) {
+            return [solve = cached.at(day), &store = *store](std::string_view input) { return solve(input, store); };
+        }
+        return solvers::find(day);
+    }
+
+    auto run_days(const Arguments& arguments) -> int {
+        const auto store = open_cache(arguments);
+
+        // every solve allocates its scratch memory from one arena that is dropped at once afterwards
+        auto arena = core::Arena{};
+        for (const auto day : arguments.days) {
+            const auto solve = make_solver(day, store);
+            const auto input = core::io::MappedFile{input_path(arguments, day)};
+
+            const auto start   = std::chrono::steady_clock::now();
+            const auto answers = [&] {
+                const auto scope = core::ResourceScope{arena};
+                CORE_PROFILE_ZONE("solve");
+                return solve(input.view());
+            }();
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            arena.reset();
+
+            std::cout << std::format("Day {}: {} | {} ({})\n", day, answers.part_one, answers.part_two,
+                                     std::chrono::duration_cast<std::chrono::microseconds>(elapsed));
+        }
+        return 0;
+    }
+
+    // Reads stdin chunk by chunk, so the input may be a pipe and far larger than the memory.
+    auto run_stream(const Arguments& arguments) -> int {
+        const auto day   = arguments.days.front();
+        const auto solve = solvers::find_stream(day);
+
+        // no arena here: it would keep every record ever read, the solver frees them as it goes
+        auto       input   = core::io::LineReader{STDIN_FILENO};
+        const auto start   = std::chrono::steady_clock::now();
+        const auto answers = [&] {
+            CORE_PROFILE_ZONE("solve");
+            return solve(input);
+        }();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << std::format("Day {}: {} | {} ({})\n", day, answers.part_one, answers.part_two,
+                                 std::chrono::duration_cast<std::chrono::microseconds>(elapsed));
+        return 0;
+    }
+
+    // Regular files of a directory in name order, or the paths listed in a manifest file.
+    // Manifest paths are relative to the manifest itself; blank lines and lines starting with '#' are skipped.
+    auto batch_inputs(const std::filesystem::path& batch) -> std::vector<std::filesystem::path> {
+        auto inputs = std::vector<std::filesystem::path>{};
+
+        if (std::filesystem::is_directory(batch)) {
+            for (const auto& entry : std::filesystem::directory_iterator{batch}) {
+                if (entry.is_regular_file()) {
+                    inputs.push_back(entry.path());
+                }
+            }
+            std::ranges::sort(inputs);
+            return inputs;
+        }
+
+        const auto manifest = core::io::MappedFile{batch};
+        for (auto line : core::strings::split_view(manifest.view(), "\n")) {
+            line = core::strings::strip(line);
+            if (not line.empty() && not line.starts_with('#')) {
+                inputs.push_back(batch.parent_path() / line);
+            }
+        }
+        return inputs;
+    }
+
+    auto solve_batch(const BatchSolver& solve, std::span<const std::filesystem::path> inputs, core::ThreadPool& pool)
+        -> std::vector<BatchResult> {
+        auto results = std::vector<BatchResult>(inputs.size());
+        core::parallel_for(pool, inputs.size(), [&](std::size_t index) {
+            // one arena per worker, reused by every input the worker picks up
+            thread_local auto arena = core::Arena{};
+
+            try {
+                const auto input = core::io::MappedFile{inputs[index]};
+                const auto scope = core::ResourceScope{arena};
+                CORE_PROFILE_ZONE("solve");
+                results[index].answers = solve(input.view());
+            } catch (const std::exception& ex) {  // NOLINT: a broken input must not stop the batch
+                results[index].error = describe(ex);
+            }
+            arena.reset();
+        });
+        return results;
+    }
+
+    // Like `solve_batch`, but the inputs are read ahead of the workers and each task solves whichever comes first.
+    auto solve_loaded(const BatchSolver& solve, core::io::FileLoader& loader, std::size_t count, core::ThreadPool& pool)
+        -> std::vector<BatchResult> {
+        auto results = std::vector<BatchResult>(count);
+
+        // a loader that fails or runs out early leaves inputs without a result, the batch can't go on then
+        auto failure       = std::optional<std::string>{};
+        auto failure_mutex = std::mutex{};
+        const auto fail    = [&](std::string_view reason) {
+            const auto lock = std::scoped_lock{failure_mutex};
+            failure         = std::string{reason};
+        };
+
+        core::parallel_for(pool, count, [&](std::size_t /*task*/) {
+            thread_local auto arena = core::Arena{};
+
+            auto input = std::optional<core::io::LoadedFile>{};
+            try {
+                input = loader.next();
+            } catch (const std::exception& ex) {  // NOLINT: whatever stopped the loader ends the batch
+                fail(describe(ex));
+                return;
+            }
+            if (not input) {
+                fail("the loader handed out fewer inputs than were listed");
+                return;
+            }
+
+            auto& result = results[input->index];
+            try {
+                if (input->error) {
+                    std::rethrow_exception(input->error);
+                }
+
+                const auto scope = core::ResourceScope{arena};
+                CORE_PROFILE_ZONE("solve");
+                result.answers = solve(input->content);
+            } catch (const std::exception& ex) {  // NOLINT: a broken input must not stop the batch
+                result.error = describe(ex);
+            }
+            arena.reset();
+        });
+
+        if (failure) {
+            throw std::runtime_error(std::format("Reading the inputs ahead failed: {}", *failure));
+        }
+        return results;
+    }
+
+    auto run_batch(const Arguments& arguments) -> int {
+        const auto day    = arguments.days.front();
+        const auto store  = open_cache(arguments);
+        const auto solve  = make_solver(day, store);
+        const auto inputs = batch_inputs(arguments.batch);
+
+        auto pool = core::ThreadPool{arguments.threads};
+
+        const auto start   = std::chrono::steady_clock::now();
+        const auto results = [&] {
+            if (arguments.read_ahead == 0) {
+                return solve_batch(solve, inputs, pool);
+            }
+            auto loader = core::io::FileLoader{inputs, arguments.read_ahead};
+            return solve_loaded(solve, loader, inputs.size(), pool);
+        }();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        auto failed = 0ul;
+        for (auto index = 0ul; index != inputs.size(); index++) {
+            const auto& [answers, error] = results[index];
+            if (error) {
+                std::cout << std::format("{}: error: {}\n", inputs[index].string(), *error);
+                failed++;
+            } else {
+                std::cout << std::format("{}: {} | {}\n", inputs[index].string(), answers.part_one, answers.part_two);
+            }
+        }
+
+        std::cout << std::format("Day {}: {} inputs, {} failed, {} threads ({})\n", day, inputs.size(), failed, pool.size(),
+                                 std::chrono::duration_cast<std::chrono::milliseconds>(elapsed));
+        return (failed == 0) ? 0 : 1;
+    }
+}  // namespace
+
 
+auto main(int argc, char* argv[]) -> int {
+    try {
+        const auto arguments = parse_arguments({argv + 1, argv + argc});
+        const auto status    = not arguments.batch.empty() ? run_batch(arguments)
+                             : (arguments.input == "-") ? run_stream(arguments)
+                                                        : run_days(arguments);
 
-auto main() -> int {
-    std::cout << "Advent of Code 2023\n";
-    return 0;
+        if constexpr (core::profile::enabled()) {
+            core::profile::write_summary(std::cerr);
+            if (not arguments.trace.empty()) {
+                auto stream = std::ofstream{arguments.trace};
+                core::profile::write_trace(stream);
+            }
+        }
+        return status;
+    } catch (const std::invalid_argument& ex) {
+        std::cerr << std::format("{}\n{}", ex.what(), usage());
+        return 2;
+    } catch (const std::exception& ex) {  // NOLINT: std::exception if fine here
+        std::cerr << std::format("Critical error: {}\n", ex.what());
+        return 1;
+    }
 }
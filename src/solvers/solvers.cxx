@@ -0,0 +1,71 @@
+#include "solvers.hxx"
+#include "day-1/trebuchet.hxx"
+#include "day-10/pipe-maze.hxx"
+#include "day-11/cosmic-expansion.hxx"
+#include "day-12/hot-springs.hxx"
+#include "day-13/point-of-incidence.hxx"
+#include "day-14/parabolic-reflector-dish.hxx"
+#include "day-15/lens-library.hxx"
+#include "day-16/the-floor-will-be-lava.hxx"
+#include "day-17/clumsy-crucible.hxx"
+#include "day-18/lavaduct-lagoon.hxx"
+#include "day-19/aplenty.hxx"
+#include "day-2/cube-conundrum.hxx"
+#include "day-20/pulse-propagation.hxx"
+#include "day-21/step-counter.hxx"
+#include "day-3/gear-ratios.hxx"
+#include "day-4/scratchcards.hxx"
+#include "day-5/seed-fertilizer.hxx"
+#include "day-6/wait-for-it.hxx"
+#include "day-7/camel-cards.hxx"
+#include "day-8/haunted-wasteland.hxx"
+#include "day-9/mirage-maintenance.hxx"
+
+#include <format>
+#include <stdexcept>
+
+
+namespace solvers {
+    auto registry() -> const Registry& {
+        static const auto REGISTRY = Registry{
+            {1, day_1::solve},   {2, day_2::solve},   {3, day_3::solve},   {4, day_4::solve},   {5, day_5::solve},
+            {6, day_6::solve},   {7, day_7::solve},   {8, day_8::solve},   {9, day_9::solve},   {10, day_10::solve},
+            {11, day_11::solve}, {12, day_12::solve}, {13, day_13::solve}, {14, day_14::solve}, {15, day_15::solve},
+            {16, day_16::solve}, {17, day_17::solve}, {18, day_18::solve}, {19, day_19::solve}, {20, day_20::solve},
+            {21, day_21::solve},
+        };
+        return REGISTRY;
+    }
+
+    auto find(std::size_t day) -> core::Solver {
+        const auto& solvers = registry();
+        if (const auto it = solvers.find(day); it != solvers.end()) {
+            return it->second;
+        }
+        throw std::invalid_argument(std::format("there is no solver for day {}", day));
+    }
+
+    auto stream_registry() -> const StreamRegistry& {
+        static const auto REGISTRY = StreamRegistry{
+            {1, day_1::solve_stream}, {2, day_2::solve_stream},  {4, day_4::solve_stream},   {6, day_6::solve_stream},
+            {7, day_7::solve_stream}, {9, day_9::solve_stream}, {12, day_12::solve_stream}, {15, day_15::solve_stream},
+        };
+        return REGISTRY;
+    }
+
+    auto find_stream(std::size_t day) -> core::StreamSolver {
+        const auto& solvers = stream_registry();
+        if (const auto it = solvers.find(day); it != solvers.end()) {
+            return it->second;
+        }
+        throw std::invalid_argument(std::format("day {} can't read its input as a stream", day));
+    }
+
+    auto cached_registry() -> const CachedRegistry& {
+        static const auto REGISTRY = CachedRegistry{
+            {1, day_1::solve_cached}, {2, day_2::solve_cached}, {4, day_4::solve_cached},
+            {7, day_7::solve_cached}, {9, day_9::solve_cached}, {19, day_19::solve_cached},
+        };
+        return REGISTRY;
+    }
+}  // namespace solvers
@@ -0,0 +1,26 @@
+#ifndef SOLVERS_SOLVERS_HXX
+#define SOLVERS_SOLVERS_HXX
+
+#include <core/solution.hxx>
+
+#include <cstddef>
+#include <map>
+
+
+namespace solvers {
+    using Registry       = std::map<std::size_t, core::Solver>;
+    using StreamRegistry = std::map<std::size_t, core::StreamSolver>;
+    using CachedRegistry = std::map<std::size_t, core::CachedSolver>;
+
+    [[nodiscard]] auto registry() -> const Registry&;
+    [[nodiscard]] auto find(std::size_t day) -> core::Solver;
+
+    // the line oriented days that can also consume their input as a stream
+    [[nodiscard]] auto stream_registry() -> const StreamRegistry&;
+    [[nodiscard]] auto find_stream(std::size_t day) -> core::StreamSolver;
+
+    // the days whose parsed model can be saved to and loaded from a core::cache::Store
+    [[nodiscard]] auto cached_registry() -> const CachedRegistry&;
+}  // namespace solvers
+
+#endif  // SOLVERS_SOLVERS_HXX
@@ -0,0 +1,156 @@
+#include "checks.hxx"
+#include "shrink.hxx"
+#include "gen/generators.hxx"
+
+#include <core/numbers.hxx>
+#include <core/strings.hxx>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+namespace {
+    struct Arguments {
+        std::vector<const verify::Check*> checks;
+        std::size_t                       cases = 200;
+        std::uint64_t                     seed  = 2023;  // NOLINT: just a default seed
+        std::optional<std::size_t>        size;
+        bool                              list = false;
+    };
+
+    auto usage() -> std::string_view {
+        return "usage: aoc-verify [--check NAME[,NAME...]] [--cases N] [--seed N] [--size N] [--list]\n"
+               "  diffs every selected engine against its reference on N random inputs (all checks by default)\n"
+               "  case K of a run uses the seed N + K, a failing input is shrunk before it is reported\n"
+               "  --size caps the scale of the generated inputs, the default is small enough to shrink quickly\n";
+    }
+
+    auto find_check(std::string_view name) -> const verify::Check* {
+        const auto& checks = verify::checks();
+        if (const auto it = std::ranges::find(checks, name, &verify::Check::name); it != checks.end()) {
+            return &*it;
+        }
+        throw std::invalid_argument(std::format("there is no check named {}", name));
+    }
+
+    auto parse_arguments(std::span<char*> arguments) -> Arguments {
+        auto result = Arguments{};
+
+        for (auto it = arguments.begin(); it != arguments.end(); ++it) {
+            const auto argument = std::string_view{*it};
+            const auto value    = [&]() -> std::string_view {
+                if (std::next(it) == arguments.end()) {
+                    throw std::invalid_argument(std::format("missing value for {}", argument));
+                }
+                return *++it;
+            };
+
+            if (argument == "--check") {
+                for (const auto name : core::strings::split_view(value(), ",")) {
+                    result.checks.push_back(find_check(name));
+                }
+            } else if (argument == "--cases") {
+                result.cases = core::numbers::parse<std::size_t>(value());
+            } else if (argument == "--seed") {
+                result.seed = core::numbers::parse<std::uint64_t>(value());
+            } else if (argument == "--size") {
+                result.size = core::numbers::parse<std::size_t>(value());
+            } else if (argument == "--list") {
+                result.list = true;
+            } else {
+                throw std::invalid_argument(std::format("unknown argument {}", argument));
+            }
+        }
+
+        if (result.checks.empty()) {
+            std::ranges::transform(verify::checks(), std::back_inserter(result.checks), [](const auto& check) {
+                return &check;
+            });
+        }
+        if (result.size == 0) {
+            throw std::invalid_argument("the size must be positive");
+        }
+
+        return result;
+    }
+
+    auto generate(const verify::Check& check, std::uint64_t seed, std::optional<std::size_t> max_size)
+        -> std::pair<std::size_t, std::string> {
+        auto random = gen::Random{seed};
+        auto output = std::ostringstream{};
+
+        const auto size = gen::uniform(random, std::size_t{1}, max_size.value_or(check.size));
+        check.generate(output, size, random);
+        return {size, std::move(output).str()};
+    }
+
+    // Runs the cases of one check up to the first disagreement, which is shrunk and reported. False on a failure.
+    auto run_check(const verify::Check& check, const Arguments& arguments) -> bool {
+        for (auto index = std::uint64_t{0}; index != arguments.cases; index++) {
+            const auto seed          = arguments.seed + index;
+            const auto [size, input] = generate(check, seed, arguments.size);
+
+            const auto failure = verify::compare(check, input);
+            if (not failure) {
+                continue;
+            }
+
+            const auto shrunk = verify::shrink(input, [&](std::string_view candidate) {
+                return verify::compare(check, candidate).has_value();
+            });
+            std::cout << std::format(
+                "{}: FAILED on case {} (--seed {} --cases 1, size {})\n  {}\n"
+                "shrunk from {} to {} bytes:\n  {}\n{}",
+                check.name, index, seed, size, *failure, input.size(), shrunk.size(),
+                verify::compare(check, shrunk).value_or("passes now, the engine isn't deterministic"), shrunk
+            );
+            return false;
+        }
+
+        std::cout << std::format("{}: {} cases agree\n", check.name, arguments.cases);
+        return true;
+    }
+}  // namespace
+
+
+auto main(int argc, char* argv[]) -> int {
+    try {
+        const auto arguments = parse_arguments({argv + 1, argv + argc});
+        if (arguments.list) {
+            for (const auto* check : arguments.checks) {
+                std::cout << std::format("{:<20} {}\n", check->name, check->description);
+            }
+            return 0;
+        }
+
+        auto failures = 0ul;
+        for (const auto* check : arguments.checks) {
+            failures += run_check(*check, arguments) ? 0 : 1;
+        }
+        if (failures != 0) {
+            std::cout << std::format("{} of {} checks failed\n", failures, arguments.checks.size());
+            return 1;
+        }
+    } catch (const std::invalid_argument& ex) {
+        std::cerr << std::format("{}\n{}", ex.what(), usage());
+        return 2;
+    } catch (const std::exception& ex) {  // NOLINT: std::exception if fine here
+        std::cerr << std::format("Critical error: {}\n", ex.what());
+        return 1;
+    }
+
+    return 0;
+}
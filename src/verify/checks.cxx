@@ -0,0 +1,378 @@
+#include "checks.hxx"
+#include "references.hxx"
+#include "day-12/hot-springs.hxx"
+#include "day-16/the-floor-will-be-lava.hxx"
+#include "day-17/clumsy-crucible.hxx"
+#include "day-18/lavaduct-lagoon.hxx"
+#include "day-21/step-counter.hxx"
+#include "solvers/solvers.hxx"
+
+#include <unistd.h>
+
+#include <core/bucket-queue.hxx>
+#include <core/cache.hxx>
+#include <core/generator.hxx>
+#include <core/io.hxx>
+#include <core/numbers.hxx>
+#include <core/parallel.hxx>
+#include <core/pipeline.hxx>
+#include <core/strings.hxx>
+#include <core/thread-pool.hxx>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+
+namespace {
+    // a few bytes per read, so records straddle the refills of the reader all the time
+    constexpr auto STREAM_CHUNK_SIZE = std::size_t{16};
+
+    // the generators of the streamed and cached days, at a scale that keeps shrinking quick
+    const auto GENERATORS = std::map<std::size_t, gen::Generator>{
+        {1, {gen::day_1, 40}},  {2, {gen::day_2, 20}},  {4, {gen::day_4, 20}},   {6, {gen::day_6, 4}},
+        {7, {gen::day_7, 40}},  {9, {gen::day_9, 20}},  {12, {gen::day_12, 12}}, {15, {gen::day_15, 60}},
+        {19, {gen::day_19, 12}},
+    };
+
+    // workers of the pool the parallel helpers are checked on, whatever the machine has
+    constexpr auto PARALLEL_WORKERS = std::size_t{8};
+
+    // the largest step of a queued key past the key popped last
+    constexpr auto MAX_QUEUE_STEP = std::uint64_t{9};
+
+    // the days checked on CRLF line ends: those that read their input as a core::Grid2D, and day 5 with its
+    // sections separated by blank lines
+    const auto CRLF_GENERATORS = std::map<std::size_t, gen::Generator>{
+        {5, {gen::day_5, 12}},   {10, {gen::day_10, 20}}, {11, {gen::day_11, 20}}, {14, {gen::day_14, 12}},
+        {16, {gen::day_16, 16}}, {17, {gen::day_17, 12}}, {21, {gen::day_21, 21}},
+    };
+
+    // A cache directory of its own for the run, removed again at exit.
+    class ScratchStore {
+    public:
+        ScratchStore()
+            : directory_{std::filesystem::temp_directory_path() / std::format("aoc-verify-{}", ::getpid())}
+            , store_{directory_} {}
+
+        ScratchStore(const ScratchStore&)                    = delete;
+        ScratchStore(ScratchStore&&)                         = delete;
+        auto operator=(const ScratchStore&) -> ScratchStore& = delete;
+        auto operator=(ScratchStore&&) -> ScratchStore&      = delete;
+
+        ~ScratchStore() {
+            auto ignored = std::error_code{};
+            std::filesystem::remove_all(directory_, ignored);
+        }
+
+        [[nodiscard]] auto store() const -> const core::cache::Store& {
+            return store_;
+        }
+
+    private:
+        std::filesystem::path directory_;
+        core::cache::Store    store_;
+    };
+
+    auto scratch_store() -> const core::cache::Store& {
+        static const auto scratch = ScratchStore{};
+        return scratch.store();
+    }
+
+    template<typename Function>
+    auto with_reader(std::string_view input, Function function) {
+        const auto file = std::unique_ptr<std::FILE, decltype(&std::fclose)>{std::tmpfile(), &std::fclose};
+        if (file == nullptr || std::fwrite(input.data(), 1, input.size(), file.get()) != input.size()
+            || std::fflush(file.get()) != 0) {
+            throw std::runtime_error("Failed to write the input to a temporary file");
+        }
+        std::rewind(file.get());
+
+        auto reader = core::io::LineReader{::fileno(file.get()), STREAM_CHUNK_SIZE};
+        return function(reader);
+    }
+
+    auto solve_streamed(core::StreamSolver solve, std::string_view input) -> core::Answers {
+        return with_reader(input, solve);
+    }
+
+    // the first call parses and saves the model, the second one loads it
+    auto solve_cached_twice(core::CachedSolver solve, std::string_view input) -> core::Answers {
+        const auto parsed = solve(input, scratch_store());
+        const auto loaded = solve(input, scratch_store());
+        if (loaded.part_one != parsed.part_one || loaded.part_two != parsed.part_two) {
+            throw std::runtime_error(std::format(
+                "The loaded model answers {} and {}, the parsed one {} and {}", loaded.part_one, loaded.part_two,
+                parsed.part_one, parsed.part_two
+            ));
+        }
+        return loaded;
+    }
+
+    auto with_crlf(std::string_view input) -> std::string {
+        auto converted = std::string{};
+        for (const auto symbol : input) {
+            converted += (symbol == '\n') ? "\r\n" : std::string_view{&symbol, 1};
+        }
+        return converted;
+    }
+
+    // the sweep of part two over the plan of part one, whose trench is small enough for the flood fill
+    auto sweep_bugged_plan(std::string_view input) -> core::Answers {
+        auto plan = day_18::parse(input);
+        plan.fixed.clear();
+        for (const auto& dig : plan.bugged) {
+            plan.fixed.push_back({.dig = dig.direction, .distance = dig.distance});
+        }
+        return {std::format("{}", day_18::part_two(plan)), ""};
+    }
+
+    auto walk_garden(std::string_view input) -> core::Answers {
+        const auto garden                  = day_21::parse(input);
+        const auto [steps, infinite_steps] = verify::reference::garden_steps(input);
+
+        auto answers = core::Answers{std::format("{}", day_21::part_one(garden, steps)), ""};
+        try {
+            answers.part_two = std::format("{}", day_21::part_two(garden, infinite_steps));
+        } catch (const std::invalid_argument&) {
+            // part two rejects gardens that aren't shaped like the published ones, the reference skips them too
+        }
+        return answers;
+    }
+
+    // Lines summed and joined by nested transform_reduce calls, one line per chunk on a pool of several workers, so
+    // the chunks finish out of order and the inner calls run on the workers.
+    auto fold_lines_in_parallel(std::string_view input) -> core::Answers {
+        static auto pool = core::ThreadPool{PARALLEL_WORKERS};
+
+        auto lines = std::vector<std::string_view>{};
+        for (const auto line : core::strings::split_view(input, "\n")) {
+            lines.push_back(line);
+        }
+
+        const auto total = core::parallel::transform_reduce(
+            pool, lines, std::int64_t{0}, std::plus<>{},
+            [](std::string_view line) {
+                const auto numbers = core::numbers::parse_numbers<std::int64_t>(line);
+                return core::parallel::transform_reduce(
+                    pool, numbers, std::int64_t{0}, std::plus<>{}, [](std::int64_t number) { return number; }, 1
+                );
+            },
+            1
+        );
+        const auto joined = core::parallel::transform_reduce(
+            pool, lines, std::string{}, std::plus<>{}, [](std::string_view line) { return std::format("{};", line); }, 1
+        );
+        return {std::format("{}", total), joined};
+    }
+
+    auto owned_records(core::io::LineReader& reader) -> core::Generator<std::string> {
+        for (const auto record : core::io::records(reader)) {
+            co_yield std::string{record};
+        }
+    }
+
+    // records handed over one per chunk with a single chunk in flight, so the reader thread waits on every one
+    auto prefetch_records(std::string_view input) -> core::Answers {
+        return with_reader(input, [](core::io::LineReader& reader) {
+            auto records = std::string{};
+            auto count   = std::size_t{0};
+            for (const auto& record : core::prefetch(owned_records(reader), 1, 1)) {
+                records += std::format("{}\n", record);
+                count++;
+            }
+            return core::Answers{std::format("{}", count), records};
+        });
+    }
+
+    // "push D", "pop" and "clear" lines, only popping a queue that holds keys
+    auto queue_operations(std::ostream& output, std::size_t size, gen::Random& random) -> void {
+        auto queued = std::size_t{0};
+        for (auto index = std::size_t{0}; index != size; index++) {
+            if (queued != 0 && gen::chance(random, 0.4)) {  // NOLINT: pop a bit less often than push
+                output << "pop\n";
+                queued--;
+            } else if (gen::chance(random, 0.02)) {  // NOLINT: rare, each clear starts over from key 0
+                output << "clear\n";
+                queued = 0;
+            } else {
+                output << std::format("push {}\n", gen::uniform(random, std::uint64_t{0}, MAX_QUEUE_STEP));
+                queued++;
+            }
+        }
+    }
+
+    auto run_bucket_queue(std::string_view input) -> core::Answers {
+        auto queue  = core::BucketQueue<std::size_t>{MAX_QUEUE_STEP};
+        auto last   = std::uint64_t{0};
+        auto popped = std::string{};
+        for (const auto line : core::strings::split_view(input, "\n")) {
+            if (line == "pop") {
+                last = queue.pop().first;
+                popped += std::format("{},", last);
+            } else if (line == "clear") {
+                queue.clear();
+                last = 0;
+            } else if (line.starts_with("push ")) {
+                queue.push(last + core::numbers::parse<std::uint64_t>(line.substr(5)), queue.size());
+            }
+        }
+        return {popped, std::format("{}", queue.size())};
+    }
+
+    auto make_checks() -> std::vector<verify::Check> {
+        auto checks = std::vector<verify::Check>{};
+
+        for (const auto& [day, solve] : solvers::stream_registry()) {
+            checks.push_back({
+                .name        = std::format("day-{}/stream", day),
+                .description = std::format("solve_stream on a reader refilled every {} bytes", STREAM_CHUNK_SIZE),
+                .generate    = GENERATORS.at(day).generate,
+                .size        = GENERATORS.at(day).size,
+                .reference   = solvers::find(day),
+                .engine      = [solve](std::string_view input) { return solve_streamed(solve, input); },
+            });
+        }
+
+        for (const auto& [day, solve] : solvers::cached_registry()) {
+            checks.push_back({
+                .name        = std::format("day-{}/cache", day),
+                .description = "solve_cached, once parsing and saving the model and once loading it",
+                .generate    = GENERATORS.at(day).generate,
+                .size        = GENERATORS.at(day).size,
+                .reference   = solvers::find(day),
+                .engine      = [solve](std::string_view input) { return solve_cached_twice(solve, input); },
+            });
+        }
+
+        for (const auto& [day, generator] : CRLF_GENERATORS) {
+            const auto solve = solvers::find(day);
+            checks.push_back({
+                .name        = std::format("day-{}/crlf", day),
+                .description = "solve on the input with CRLF line ends",
+                .generate    = generator.generate,
+                .size        = generator.size,
+                .reference   = solve,
+                .engine      = [solve](std::string_view input) { return solve(with_crlf(input)); },
+            });
+        }
+
+        checks.push_back({
+            .name        = "day-12/memoized",
+            .description = "memoized placement of the groups against enumerating every arrangement",
+            .generate    = gen::day_12,
+            .size        = 12,
+            .reference   = verify::reference::day_12,
+            .engine      = day_12::solve,
+        });
+        checks.push_back({
+            .name        = "day-16/bit-grid",
+            .description = "beams tracked on bit grids against a set of visited tiles",
+            .generate    = gen::day_16,
+            .size        = 24,
+            .reference   = verify::reference::day_16,
+            .engine      = day_16::solve,
+        });
+        checks.push_back({
+            .name        = "day-17/bucket-queue",
+            .description = "Dijkstra on bucket queues against a binary heap",
+            .generate    = gen::day_17,
+            .size        = 20,
+            .reference   = verify::reference::day_17,
+            .engine      = day_17::solve,
+        });
+        checks.push_back({
+            .name        = "day-18/sweep",
+            .description = "the sweep of part two against the flood fill of part one",
+            .generate    = gen::day_18,
+            .size        = 40,
+            .reference   = verify::reference::day_18,
+            .engine      = sweep_bugged_plan,
+        });
+        checks.push_back({
+            .name        = "day-21/bit-grid",
+            .description = "word parallel BFS and the quadratic fit over a 5 x 5 tiled walk against a plain BFS",
+            .generate    = gen::day_21,
+            .size        = 43,
+            .reference   = verify::reference::day_21,
+            .engine      = walk_garden,
+        });
+        checks.push_back({
+            .name        = "core/parallel",
+            .description = "nested transform_reduce on a pool of 8 workers against a fold in order",
+            .generate    = gen::day_9,
+            .size        = 20,
+            .reference   = verify::reference::fold_lines,
+            .engine      = fold_lines_in_parallel,
+        });
+        checks.push_back({
+            .name        = "core/prefetch",
+            .description = "records handed over by prefetch one at a time against splitting the input",
+            .generate    = gen::day_1,
+            .size        = 40,
+            .reference   = verify::reference::read_records,
+            .engine      = prefetch_records,
+        });
+        checks.push_back({
+            .name        = "core/bucket-queue",
+            .description = "BucketQueue against std::priority_queue on random monotone operations",
+            .generate    = queue_operations,
+            .size        = 200,
+            .reference   = verify::reference::queue_operations,
+            .engine      = run_bucket_queue,
+        });
+
+        return checks;
+    }
+}  // namespace
+
+
+namespace verify {
+    auto checks() -> const std::vector<Check>& {
+        static const auto CHECKS = make_checks();
+        return CHECKS;
+    }
+
+    auto compare(const Check& check, std::string_view input) -> std::optional<std::string> {
+        auto expected = core::Answers{};
+        try {
+            expected = check.reference(input);
+        } catch (const std::exception&) {  // NOLINT: std::exception if fine here
+            return std::nullopt;
+        }
+
+        auto actual = core::Answers{};
+        try {
+            actual = check.engine(input);
+        } catch (const std::exception& ex) {  // NOLINT: std::exception if fine here
+            return std::format("the engine failed: {}", ex.what());
+        }
+
+        const auto parts = std::array{
+            std::tuple{"part one", expected.part_one, actual.part_one},
+            std::tuple{"part two", expected.part_two, actual.part_two},
+        };
+        for (const auto& [part, reference, engine] : parts) {
+            if (not reference.empty() && reference != engine) {
+                return std::format("{}: expected {}, got {}", part, reference, engine);
+            }
+        }
+        return std::nullopt;
+    }
+}  // namespace verify
@@ -0,0 +1,37 @@
+#ifndef VERIFY_CHECKS_HXX
+#define VERIFY_CHECKS_HXX
+
+#include "gen/generators.hxx"
+
+#include <core/solution.hxx>
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace verify {
+    // answers of one implementation, a part left empty by the reference isn't compared
+    using Engine = std::function<core::Answers(std::string_view input)>;
+
+    // An engine and the reference its answers must match on every input the generator makes.
+    struct Check {
+        std::string   name;  // day-N/engine or core/component
+        std::string   description;
+        gen::Generate generate = nullptr;
+        std::size_t   size     = 0;  // the largest scale handed to the generator
+        Engine        reference;
+        Engine        engine;
+    };
+
+    [[nodiscard]] auto checks() -> const std::vector<Check>&;
+
+    // Why the engine disagrees with the reference on `input`. Nothing when they agree or when the reference rejects
+    // the input by throwing, which the shrinker runs into when it breaks the rules of a puzzle.
+    [[nodiscard]] auto compare(const Check& check, std::string_view input) -> std::optional<std::string>;
+}  // namespace verify
+
+#endif  // VERIFY_CHECKS_HXX
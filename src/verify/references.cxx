@@ -0,0 +1,374 @@
+#include "references.hxx"
+#include "day-12/hot-springs.hxx"
+#include "day-18/lavaduct-lagoon.hxx"
+
+#include <core/numbers.hxx>
+#include <core/strings.hxx>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <limits>
+#include <map>
+#include <optional>
+#include <queue>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+
+namespace {
+    using Rows     = std::vector<std::string>;
+    using Position = std::pair<std::int64_t, std::int64_t>;  // row, column
+
+    // up, right, down, left: turning right is the next heading, turning around the one two further
+    constexpr auto HEADINGS = std::array<Position, 4>{{{-1, 0}, {0, 1}, {1, 0}, {0, -1}}};
+
+    auto load_rows(std::string_view input) -> Rows {
+        auto rows = Rows{};
+        for (const auto line : core::strings::split_view(input, "\n")) {
+            if (not line.empty()) {
+                rows.emplace_back(line);
+            }
+        }
+        if (rows.empty() || std::ranges::any_of(rows, [&](const auto& row) { return row.size() != rows[0].size(); })) {
+            throw std::invalid_argument("The grid is empty or not rectangular");
+        }
+        return rows;
+    }
+
+    auto contains(const Rows& rows, Position position) -> bool {
+        return position.first >= 0 && position.second >= 0 && std::cmp_less(position.first, rows.size())
+            && std::cmp_less(position.second, rows[0].size());
+    }
+
+    auto at(const Rows& rows, Position position) -> char {
+        return rows[static_cast<std::size_t>(position.first)][static_cast<std::size_t>(position.second)];
+    }
+
+    auto step(Position position, std::size_t heading) -> Position {
+        return {position.first + HEADINGS[heading].first, position.second + HEADINGS[heading].second};
+    }
+
+    // lengths of the runs of '#'
+    auto damaged_groups(std::string_view cells) -> std::vector<std::size_t> {
+        auto groups = std::vector<std::size_t>{};
+        auto run    = 0ul;
+        for (const auto cell : cells) {
+            if (cell == '#') {
+                run++;
+            } else if (run != 0) {
+                groups.push_back(std::exchange(run, 0));
+            }
+        }
+        if (run != 0) {
+            groups.push_back(run);
+        }
+        return groups;
+    }
+
+    // whether the settled prefix `cells` can still grow into the groups `sizes`
+    auto can_extend(std::string_view cells, std::span<const std::size_t> sizes) -> bool {
+        const auto groups = damaged_groups(cells);
+        if (groups.size() > sizes.size()) {
+            return false;
+        }
+
+        // the last group is still open when the prefix ends on a damaged spring
+        const auto open   = not cells.empty() && cells.back() == '#';
+        const auto closed = groups.size() - (open ? 1 : 0);
+        if (not std::ranges::equal(std::span{groups}.first(closed), sizes.first(closed))) {
+            return false;
+        }
+        return not open || groups.back() <= sizes[closed];
+    }
+
+    auto count_arrangements(std::string& cells, std::size_t index, std::span<const std::size_t> sizes) -> std::size_t {
+        if (not can_extend(std::string_view{cells}.substr(0, index), sizes)) {
+            return 0;
+        }
+        if (index == cells.size()) {
+            return std::ranges::equal(damaged_groups(cells), sizes) ? 1 : 0;
+        }
+        if (cells[index] != '?') {
+            return count_arrangements(cells, index + 1, sizes);
+        }
+
+        auto total = std::size_t{0};
+        for (const auto guess : {'#', '.'}) {
+            cells[index] = guess;
+            total += count_arrangements(cells, index + 1, sizes);
+        }
+        cells[index] = '?';
+        return total;
+    }
+
+    auto energized_tiles(const Rows& rows, Position start, std::size_t start_heading) -> std::size_t {
+        auto seen  = std::set<std::tuple<std::int64_t, std::int64_t, std::size_t>>{};
+        auto tiles = std::set<Position>{};
+        auto beams = std::vector<std::pair<Position, std::size_t>>{{start, start_heading}};
+        while (not beams.empty()) {
+            const auto [position, heading] = beams.back();
+            beams.pop_back();
+            if (not contains(rows, position) || not seen.emplace(position.first, position.second, heading).second) {
+                continue;
+            }
+            tiles.insert(position);
+
+            const auto vertical = heading % 2 == 0;
+            auto       next     = std::vector<std::size_t>{};
+            switch (at(rows, position)) {
+                case '/': next = {heading ^ 1u}; break;   // up <-> right, down <-> left
+                case '\\': next = {3 - heading}; break;  // up <-> left, right <-> down
+                case '|': next = vertical ? std::vector{heading} : std::vector{0ul, 2ul}; break;
+                case '-': next = vertical ? std::vector{1ul, 3ul} : std::vector{heading}; break;
+                default: next = {heading}; break;
+            }
+            for (const auto turned : next) {
+                beams.emplace_back(step(position, turned), turned);
+            }
+        }
+        return tiles.size();
+    }
+
+    auto minimum_heat_loss(const Rows& rows, std::size_t min_run, std::size_t max_run) -> std::int64_t {
+        using Entry = std::tuple<std::int64_t, Position, std::size_t, std::size_t>;  // heat loss, block, heading, run
+
+        auto queue = std::priority_queue<Entry, std::vector<Entry>, std::greater<>>{};
+        auto seen  = std::set<std::tuple<Position, std::size_t, std::size_t>>{};
+        queue.emplace(0, Position{0, 0}, 1, 0);
+        queue.emplace(0, Position{0, 0}, 2, 0);
+
+        const auto destination = Position{std::ssize(rows) - 1, std::ssize(rows[0]) - 1};
+        while (not queue.empty()) {
+            const auto [heat_loss, position, heading, run] = queue.top();
+            queue.pop();
+            if (not seen.emplace(position, heading, run).second) {
+                continue;
+            }
+            if (position == destination && run >= min_run) {
+                return heat_loss;
+            }
+
+            for (auto turned = 0ul; turned != HEADINGS.size(); turned++) {
+                if (turned == (heading + 2) % HEADINGS.size()) {
+                    continue;  // no turning back
+                }
+
+                const auto straight = turned == heading;
+                if ((straight && run == max_run) || (not straight && run < min_run)) {
+                    continue;
+                }
+                if (const auto next = step(position, turned); contains(rows, next)) {
+                    queue.emplace(heat_loss + (at(rows, next) - '0'), next, turned, straight ? run + 1 : 1);
+                }
+            }
+        }
+
+        throw std::invalid_argument("The crucible can't reach the factory");
+    }
+
+    // plots reached in exactly `steps` steps, on the garden repeated in every direction when `tiled`
+    auto reachable_plots(const Rows& rows, Position start, std::size_t steps, bool tiled) -> std::size_t {
+        const auto side = Position{std::ssize(rows), std::ssize(rows[0])};
+        const auto plot = [&](Position position) {
+            if (tiled) {
+                position = {((position.first % side.first) + side.first) % side.first,
+                            ((position.second % side.second) + side.second) % side.second};
+            } else if (not contains(rows, position)) {
+                return false;
+            }
+            return at(rows, position) != '#';
+        };
+
+        auto distances = std::map<Position, std::size_t>{{start, 0}};
+        auto queue     = std::queue<Position>{{start}};
+        auto reached   = std::size_t{0};
+        while (not queue.empty()) {
+            const auto position = queue.front();
+            const auto distance = distances[position];
+            queue.pop();
+            reached += (distance % 2 == steps % 2) ? 1 : 0;
+            if (distance == steps) {
+                continue;
+            }
+
+            for (auto heading = 0ul; heading != HEADINGS.size(); heading++) {
+                if (const auto next = step(position, heading); plot(next) && not distances.contains(next)) {
+                    distances.emplace(next, distance + 1);
+                    queue.push(next);
+                }
+            }
+        }
+        return reached;
+    }
+
+    // What part two expects: an odd square like the published ones, the start in the centre and clear middle lines
+    // and border, so that every copy of the garden is entered at its corners or in the middle of its sides.
+    auto is_published_shape(const Rows& rows, Position start) -> bool {
+        const auto side   = std::ssize(rows);
+        const auto middle = side / 2;
+        if (side != std::ssize(rows[0]) || side % 2 == 0 || start != Position{middle, middle}) {
+            return false;
+        }
+
+        for (auto index = std::int64_t{0}; index != side; index++) {
+            for (const auto& cell : {Position{middle, index}, Position{index, middle}, Position{0, index},
+                                     Position{side - 1, index}, Position{index, 0}, Position{index, side - 1}}) {
+                if (at(rows, cell) == '#') {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}  // namespace
+
+
+namespace verify::reference {
+    auto day_12(std::string_view input) -> core::Answers {
+        auto total = std::size_t{0};
+        for (auto spring : day_12::parse(input)) {
+            total += count_arrangements(spring.condition, 0, spring.damage_sizes);
+        }
+        return {std::format("{}", total), ""};
+    }
+
+    auto day_16(std::string_view input) -> core::Answers {
+        const auto rows = load_rows(input);
+        const auto last = Position{std::ssize(rows) - 1, std::ssize(rows[0]) - 1};
+
+        auto most = std::size_t{0};
+        for (auto row = std::int64_t{0}; row <= last.first; row++) {
+            most = std::max({most, energized_tiles(rows, {row, 0}, 1), energized_tiles(rows, {row, last.second}, 3)});
+        }
+        for (auto col = std::int64_t{0}; col <= last.second; col++) {
+            most = std::max({most, energized_tiles(rows, {0, col}, 2), energized_tiles(rows, {last.first, col}, 0)});
+        }
+        return {std::format("{}", energized_tiles(rows, {0, 0}, 1)), std::format("{}", most)};
+    }
+
+    auto day_17(std::string_view input) -> core::Answers {
+        const auto rows = load_rows(input);
+        if (std::ranges::any_of(rows, [](const auto& row) { return row.find_first_not_of("123456789") != row.npos; })) {
+            throw std::invalid_argument("The map has a block that isn't a digit");
+        }
+
+        constexpr auto CRUCIBLE       = std::pair{1ul, 3ul};
+        constexpr auto ULTRA_CRUCIBLE = std::pair{4ul, 10ul};
+        return {
+            std::format("{}", minimum_heat_loss(rows, CRUCIBLE.first, CRUCIBLE.second)),
+            std::format("{}", minimum_heat_loss(rows, ULTRA_CRUCIBLE.first, ULTRA_CRUCIBLE.second)),
+        };
+    }
+
+    auto day_18(std::string_view input) -> core::Answers {
+        // the flood fill takes any trench, the sweep of part two wants a loop that doesn't touch itself
+        const auto plan    = day_18::parse(input);
+        auto       trench  = std::set<core::Coordinate>{};
+        auto       current = core::Coordinate{};
+        for (const auto& dig : plan.bugged) {
+            for (auto steps = std::int64_t{0}; steps != dig.distance; steps++) {
+                current = current + dig.direction;
+                if (not trench.insert(current).second) {
+                    throw std::invalid_argument("The trench crosses itself");
+                }
+            }
+        }
+        if (plan.bugged.empty() || current != core::Coordinate{}) {
+            throw std::invalid_argument("The trench isn't a loop");
+        }
+
+        return {std::format("{}", day_18::part_one(plan)), ""};
+    }
+
+    auto day_21(std::string_view input) -> core::Answers {
+        const auto rows  = load_rows(input);
+        auto       start = std::optional<Position>{};
+        for (auto row = 0ul; row != rows.size(); row++) {
+            if (const auto col = rows[row].find('S'); col != std::string::npos) {
+                start = Position{static_cast<std::int64_t>(row), static_cast<std::int64_t>(col)};
+            }
+        }
+        if (not start) {
+            throw std::invalid_argument("The garden has no start");
+        }
+
+        const auto [steps, infinite_steps] = garden_steps(input);
+        auto answers = core::Answers{std::format("{}", reachable_plots(rows, *start, steps, false)), ""};
+        if (is_published_shape(rows, *start)) {
+            answers.part_two = std::format("{}", reachable_plots(rows, *start, infinite_steps, true));
+        }
+        return answers;
+    }
+
+    auto fold_lines(std::string_view input) -> core::Answers {
+        auto total  = std::int64_t{0};
+        auto joined = std::string{};
+        for (const auto line : core::strings::split_view(input, "\n")) {
+            for (const auto number : core::numbers::parse_numbers<std::int64_t>(line)) {
+                total += number;
+            }
+            joined += std::format("{};", line);
+        }
+        return {std::format("{}", total), joined};
+    }
+
+    auto read_records(std::string_view input) -> core::Answers {
+        auto records = std::string{};
+        auto count   = std::size_t{0};
+        while (not input.empty()) {
+            const auto end = std::min(input.find('\n'), input.size());
+            records += std::format("{}\n", input.substr(0, end));
+            count++;
+            input.remove_prefix(std::min(end + 1, input.size()));
+        }
+        return {std::format("{}", count), records};
+    }
+
+    auto queue_operations(std::string_view input) -> core::Answers {
+        auto queue  = std::priority_queue<std::uint64_t, std::vector<std::uint64_t>, std::greater<>>{};
+        auto last   = std::uint64_t{0};
+        auto popped = std::string{};
+        for (const auto line : core::strings::split_view(input, "\n")) {
+            if (line == "pop") {
+                if (queue.empty()) {
+                    throw std::invalid_argument("Popped an empty queue");
+                }
+                last = queue.top();
+                queue.pop();
+                popped += std::format("{},", last);
+            } else if (line == "clear") {
+                queue = {};
+                last  = 0;
+            } else if (line.starts_with("push ")) {
+                queue.push(last + core::numbers::parse<std::uint64_t>(line.substr(5)));
+            } else if (not line.empty()) {
+                throw std::invalid_argument("Unknown queue operation");
+            }
+        }
+        return {popped, std::format("{}", queue.size())};
+    }
+
+    auto garden_steps(std::string_view garden) -> std::pair<std::size_t, std::size_t> {
+        const auto side = load_rows(garden).size();
+        const auto half = side / 2;
+
+        // in the tiled walk, on the rings of copies and off them, then the extrapolated fourth ring
+        const auto infinite = std::array{
+            std::size_t{0}, std::size_t{1},  half + 1,       half + side - 1,
+            2 * side,       half + 2 * side, half + 3 * side, half + 4 * side,
+        };
+
+        const auto pick = static_cast<std::size_t>(std::ranges::count(garden, '#'));
+        return {half + (pick / infinite.size()) % 2, infinite[pick % infinite.size()]};
+    }
+}  // namespace verify::reference
@@ -0,0 +1,46 @@
+#ifndef VERIFY_REFERENCES_HXX
+#define VERIFY_REFERENCES_HXX
+
+#include <core/solution.hxx>
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+
+// Straightforward solutions the fast engines of the days are diffed against: plain containers, exhaustive
+// searches and no shortcuts. A part too expensive to brute force is left empty, an input outside of the rules
+// of the puzzle is rejected with std::invalid_argument.
+namespace verify::reference {
+    // enumerates every arrangement, part one only
+    auto day_12(std::string_view input) -> core::Answers;
+
+    // traces every beam through a set of visited (tile, heading) pairs
+    auto day_16(std::string_view input) -> core::Answers;
+
+    // Dijkstra on a binary heap over (block, heading, run length)
+    auto day_17(std::string_view input) -> core::Answers;
+
+    // flood fill around the trench of the bugged plan, part one only
+    auto day_18(std::string_view input) -> core::Answers;
+
+    // BFS over the garden, part two walks the tiled garden for gardens shaped like the published ones
+    auto day_21(std::string_view input) -> core::Answers;
+
+    // the numbers of every line summed up and the lines joined by ';', folded in order
+    auto fold_lines(std::string_view input) -> core::Answers;
+
+    // the records of the input joined by '\n' and their count, a last record without a delimiter included
+    auto read_records(std::string_view input) -> core::Answers;
+
+    // Lines of "push D" queueing the last popped key plus D, "pop" and "clear" on a std::priority_queue: the popped
+    // keys joined by ',' and the number of keys left. Popping an empty queue is rejected.
+    auto queue_operations(std::string_view input) -> core::Answers;
+
+    // Steps of the two day 21 walks, picked by the number of rocks in the garden so that the cases vary. Part one
+    // walks to the middle of the sides or one step further. Part two takes a small walk, a walk ending on or off a
+    // ring of copies within the two rings it measures, or a walk out to the third or fourth ring it extrapolates to.
+    auto garden_steps(std::string_view garden) -> std::pair<std::size_t, std::size_t>;
+}  // namespace verify::reference
+
+#endif  // VERIFY_REFERENCES_HXX
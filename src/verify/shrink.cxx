@@ -0,0 +1,117 @@
+#include "shrink.hxx"
+
+#include <core/strings.hxx>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace {
+    using Lines   = std::vector<std::string>;
+    using Indices = std::vector<std::size_t>;
+
+    auto split_lines(std::string_view input) -> Lines {
+        auto lines = Lines{};
+        for (const auto line : core::strings::split_view(input, "\n")) {
+            lines.emplace_back(line);
+        }
+        // the final newline doesn't start another line
+        if (not lines.empty() && lines.back().empty()) {
+            lines.pop_back();
+        }
+        return lines;
+    }
+
+    auto join_lines(const Lines& lines, const Indices& kept) -> std::string {
+        auto input = std::string{};
+        for (const auto index : kept) {
+            input += lines[index];
+            input += '\n';
+        }
+        return input;
+    }
+
+    auto keep_columns(const Lines& lines, const Indices& kept) -> std::string {
+        auto input = std::string{};
+        for (const auto& line : lines) {
+            for (const auto index : kept) {
+                input += line[index];
+            }
+            input += '\n';
+        }
+        return input;
+    }
+
+    // Drops runs of `count` parts, halving the run length whenever no run of the current length can go. `build`
+    // makes the input out of the indices of the parts that are left.
+    template<typename Build>
+    auto remove_runs(std::size_t count, Build build, const verify::Predicate& fails) -> Indices {
+        auto kept = Indices(count);
+        std::iota(kept.begin(), kept.end(), std::size_t{0});
+
+        for (auto run = std::max(count / 2, std::size_t{1}); run != 0 && kept.size() > 1; run /= 2) {
+            for (auto start = 0ul; start < kept.size() && kept.size() > 1;) {
+                auto candidate = kept;
+                candidate.erase(
+                    candidate.begin() + static_cast<std::ptrdiff_t>(start),
+                    candidate.begin() + static_cast<std::ptrdiff_t>(std::min(start + run, candidate.size()))
+                );
+                if (not candidate.empty() && fails(build(candidate))) {
+                    kept = std::move(candidate);
+                } else {
+                    start += run;
+                }
+            }
+        }
+
+        return kept;
+    }
+
+    auto join_fields(const Lines& fields, const Indices& kept) -> std::string {
+        auto input = std::string{};
+        for (const auto index : kept) {
+            input += input.empty() ? "" : ",";
+            input += fields[index];
+        }
+        return input + '\n';
+    }
+
+    auto is_rectangular(const Lines& lines) -> bool {
+        return lines.size() > 1
+            && std::ranges::all_of(lines, [&](const auto& line) { return line.size() == lines[0].size(); });
+    }
+}  // namespace
+
+
+namespace verify {
+    auto shrink(std::string input, const Predicate& fails) -> std::string {
+        while (true) {
+            const auto before = input.size();
+
+            const auto lines    = split_lines(input);
+            const auto by_lines = [&](const Indices& kept) { return join_lines(lines, kept); };
+            input               = by_lines(remove_runs(lines.size(), by_lines, fails));
+
+            if (const auto rows = split_lines(input); is_rectangular(rows)) {
+                const auto by_columns = [&](const Indices& kept) { return keep_columns(rows, kept); };
+                input                 = by_columns(remove_runs(rows[0].size(), by_columns, fails));
+            } else if (rows.size() == 1) {
+                // a single record of comma separated steps like day 15
+                auto fields = Lines{};
+                for (const auto field : core::strings::split_view(rows[0], ",")) {
+                    fields.emplace_back(field);
+                }
+                const auto by_fields = [&](const Indices& kept) { return join_fields(fields, kept); };
+                input                = by_fields(remove_runs(fields.size(), by_fields, fails));
+            }
+
+            if (input.size() == before) {
+                return input;
+            }
+        }
+    }
+}  // namespace verify
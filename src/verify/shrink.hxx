@@ -0,0 +1,17 @@
+#ifndef VERIFY_SHRINK_HXX
+#define VERIFY_SHRINK_HXX
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+
+namespace verify {
+    using Predicate = std::function<bool(std::string_view input)>;
+
+    // A smaller input on which `fails` still holds. Ever shorter runs of lines are dropped (delta debugging), then
+    // runs of columns when the lines are all equally long like the grid days, until neither pass removes anything.
+    auto shrink(std::string input, const Predicate& fails) -> std::string;
+}  // namespace verify
+
+#endif  // VERIFY_SHRINK_HXX